@@ -0,0 +1,185 @@
+/// 
+/// vectori.h Benchmarks: vector vs. a raw growable array
+///		Both implementations work on runtime element sizes with memcpy/memmove,
+///		so the raw array is the floor for what the generic vector API can cost.
+///		See bench_std.cpp for the C++ std::vector baseline.
+/// 
+#define _POSIX_C_SOURCE 199309L
+#include "../vectori.h"
+#include "bench.h"
+
+static size_t bench_keySize;
+static volatile size_t bench_sink;
+
+static int bench_compare(const void_t* a, const void_t* b) {
+	return memcmp(a, b, bench_keySize);
+}
+
+/// Returns the time in ns of one run of [op] through the vector API over [count] items from [items].
+static uint64_t bench_vector(int op, size_t size, size_t count, const uint08_t* items) {
+	vector v = vector_calloc2((int32_t) size, count, true);
+	if (op != BENCH_PUSH_BACK && op != BENCH_INSERT_FRONT && op != BENCH_INSERT_MIDDLE)
+		vector_append_range(&v, items, count);
+	else
+		v = (vector_free(&v), vector_calloc((int32_t) size, false));
+
+	size_t sink = 0;
+	uint64_t start = bench_now();
+	switch (op) {
+		case BENCH_PUSH_BACK:
+			for (size_t i = 0; i < count; i++)
+				vector_insert(&v, (void_t*)(items + i * size), vector_count(&v));
+		break;
+		case BENCH_INSERT_FRONT:
+			for (size_t i = 0; i < count; i++)
+				vector_insert(&v, (void_t*)(items + i * size), 0);
+		break;
+		case BENCH_INSERT_MIDDLE:
+			for (size_t i = 0; i < count; i++)
+				vector_insert(&v, (void_t*)(items + i * size), vector_count(&v) / 2);
+		break;
+		case BENCH_REMOVE_FRONT:
+			for (size_t i = 0; i < count; i++)
+				vector_remove(&v, 0);
+		break;
+		case BENCH_GET:
+			for (size_t i = 0; i < count; i++)
+				sink += *(uint08_t*) vector_get(&v, i);
+		break;
+		case BENCH_CLEAR:
+			vector_clear(&v, (void_t*) items);
+		break;
+		case BENCH_QSORT:
+			bench_keySize = BENCH_KEY(size);
+			vector_qsort(&v, bench_compare);
+		break;
+		case BENCH_MAKESTR: {
+			size_t length = 0;
+			char_t* string = vector_makestr(&v, 0, count, &length);
+			sink += length;
+			free(string);
+		} break;
+	}
+	uint64_t ns = bench_now() - start;
+
+	bench_sink += sink;
+	vector_free(&v);
+	return ns;
+}
+
+/// Returns TRUE if the raw array of [size]-byte items can hold [count] items (doubling), else FALSE.
+static bool_t bench_raw_grow(uint08_t** data, size_t* capacity, size_t count, size_t size) {
+	if (count <= *capacity)
+		return true;
+	size_t grown = (*capacity > 0)? *capacity * 2 : VECTOR_DEFAULT_LENGTH;
+	uint08_t* moved = (uint08_t*) realloc(*data, grown * size);
+	if (moved == NULL)
+		return false;
+	*data = moved;
+	*capacity = grown;
+	return true;
+}
+
+/// Returns TRUE if [item] was inserted at [index] of the raw array, else FALSE.
+static bool_t bench_raw_insert(uint08_t** data, size_t* capacity, size_t* count, size_t size, const uint08_t* item, size_t index) {
+	if (!bench_raw_grow(data, capacity, *count + 1, size))
+		return false;
+	memmove(*data + (index + 1) * size, *data + index * size, (*count - index) * size);
+	memcpy(*data + index * size, item, size);
+	(*count)++;
+	return true;
+}
+
+/// Returns the time in ns of one run of [op] hand-written over a raw malloc'd array of [count] items from [items].
+static uint64_t bench_raw(int op, size_t size, size_t count, const uint08_t* items) {
+	size_t length = 0, capacity = 0;
+	uint08_t* data = NULL;
+	if (op != BENCH_PUSH_BACK && op != BENCH_INSERT_FRONT && op != BENCH_INSERT_MIDDLE) {
+		data = (uint08_t*) malloc(count * size);
+		memcpy(data, items, count * size);
+		length = capacity = count;
+	}
+
+	size_t sink = 0;
+	uint64_t start = bench_now();
+	switch (op) {
+		case BENCH_PUSH_BACK:
+			for (size_t i = 0; i < count; i++)
+				bench_raw_insert(&data, &capacity, &length, size, items + i * size, length);
+		break;
+		case BENCH_INSERT_FRONT:
+			for (size_t i = 0; i < count; i++)
+				bench_raw_insert(&data, &capacity, &length, size, items + i * size, 0);
+		break;
+		case BENCH_INSERT_MIDDLE:
+			for (size_t i = 0; i < count; i++)
+				bench_raw_insert(&data, &capacity, &length, size, items + i * size, length / 2);
+		break;
+		case BENCH_REMOVE_FRONT:
+			for (size_t i = 0; i < count; i++) {
+				memmove(data, data + size, (length - 1) * size);
+				length--;
+			}
+		break;
+		case BENCH_GET:
+			for (size_t i = 0; i < count; i++)
+				sink += data[i * size];
+		break;
+		case BENCH_CLEAR:
+			for (size_t i = 0; i < count; i++)
+				memcpy(data + i * size, items, size);
+			length = 0;
+		break;
+		case BENCH_QSORT:
+			bench_keySize = BENCH_KEY(size);
+			qsort(data, count, size, bench_compare);
+		break;
+		case BENCH_MAKESTR: {
+			char_t* string = (char_t*) malloc(count * size + 1);
+			memcpy(string, data, count * size);
+			string[count * size] = '\0';
+			sink += count * size;
+			free(string);
+		} break;
+	}
+	uint64_t ns = bench_now() - start;
+
+	bench_sink += sink + length;
+	free(data);
+	return ns;
+}
+
+int main(int argc, char** argv) {
+	bench_options options;
+	if (bench_parse(&options, argc, argv) != 0)
+		return 1;
+
+	bench_header(&options);
+	for (size_t s = 0; s < BENCH_SIZES; s++)
+		for (size_t count = 100; count <= options.maxCount; count *= 10) {
+			size_t size = bench_sizes[s];
+			if (count * size > options.maxBytes)
+				break;
+
+			uint08_t* items = (uint08_t*) malloc(count * size);
+			if (items == NULL)
+				break;
+			bench_random(items, count * size);
+
+			for (int op = 0; op < BENCH_OPS; op++) {
+				if (!bench_enabled(&options, op, size, count))
+					continue;
+
+				size_t reps = bench_reps(&options, count);
+				uint64_t bestVector = UINT64_MAX, bestRaw = UINT64_MAX;
+				for (size_t r = 0; r < reps; r++) {
+					bestVector = VECTOR_MIN(bestVector, bench_vector(op, size, count, items));
+					bestRaw = VECTOR_MIN(bestRaw, bench_raw(op, size, count, items));
+				}
+				bench_report(&options, "vectori", op, size, count, reps, bestVector);
+				bench_report(&options, "raw_array", op, size, count, reps, bestRaw);
+			}
+			free(items);
+		}
+	return 0;
+}
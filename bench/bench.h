@@ -0,0 +1,122 @@
+/// 
+/// vectori.h Benchmark Harness (shared by bench.c and bench_std.cpp)
+///		Every program times the same operations over the same element sizes and
+///		counts, and prints one record per (implementation, operation, size, count)
+///		as CSV (default) or JSON Lines (--json), so the output of several runs can
+///		be concatenated and loaded into a dashboard as one table.
+///		
+///		Records report the best of [reps] runs: ns_per_item = total_ns / count.
+/// 
+#ifndef VECTORI_BENCH_H
+#define VECTORI_BENCH_H
+	#include <stdio.h>
+	#include <stdlib.h>
+	#include <string.h>
+	#include <stdint.h>
+	#include <time.h>
+
+	enum {
+		BENCH_PUSH_BACK, BENCH_INSERT_FRONT, BENCH_INSERT_MIDDLE, BENCH_REMOVE_FRONT,
+		BENCH_GET, BENCH_CLEAR, BENCH_QSORT, BENCH_MAKESTR, BENCH_OPS
+	};
+
+	static const char* const bench_names[BENCH_OPS] = {
+		"push_back", "insert_front", "insert_middle", "remove_front", "get", "clear", "qsort", "makestr"
+	};
+
+	/// Element sizes in bytes (element types of bench_std.cpp must match).
+	static const size_t bench_sizes[] = { 1, 4, 16, 64, 256 };
+	#define BENCH_SIZES (sizeof(bench_sizes) / sizeof(bench_sizes[0]))
+
+	/// Bytes compared by the qsort key (the first min(size, 4) bytes of each element).
+	#define BENCH_KEY(size) ((size) < 4? (size) : 4)
+
+	typedef struct bench_options {
+		size_t maxCount;     // Largest item count (powers of ten from 1e2)
+		size_t maxQuadratic; // Largest item count for the O(n^2) front/middle insert and remove
+		size_t maxBytes;     // Skips sizes whose count * size exceeds this
+		size_t reps;         // Minimum repetitions per record
+		int json;            // JSON Lines output instead of CSV
+		const char* only;    // Runs a single operation by name (NULL for all)
+	} bench_options;
+
+	static uint64_t bench_now(void) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+	}
+
+	/// Returns 0 if the arguments were parsed into [options], else prints usage and returns 1.
+	static int bench_parse(bench_options* options, int argc, char** argv) {
+		options->maxCount = 100000000;
+		options->maxQuadratic = 10000;
+		options->maxBytes = (size_t) 1 << 30;
+		options->reps = 3;
+		options->json = 0;
+		options->only = NULL;
+
+		for (int i = 1; i < argc; i++) {
+			const char* arg = argv[i];
+			const char* value = (i + 1 < argc)? argv[i + 1] : NULL;
+			if (strcmp(arg, "--json") == 0) { options->json = 1; continue; }
+			if (strcmp(arg, "--csv") == 0) { options->json = 0; continue; }
+			if (value == NULL) goto usage;
+
+			if (strcmp(arg, "--max-count") == 0) options->maxCount = (size_t) strtod(value, NULL);
+			else if (strcmp(arg, "--max-quadratic") == 0) options->maxQuadratic = (size_t) strtod(value, NULL);
+			else if (strcmp(arg, "--max-bytes") == 0) options->maxBytes = (size_t) strtod(value, NULL);
+			else if (strcmp(arg, "--reps") == 0) options->reps = (size_t) strtod(value, NULL);
+			else if (strcmp(arg, "--op") == 0) options->only = value;
+			else goto usage;
+			i++;
+		}
+		return 0;
+
+		usage:
+		fprintf(stderr, "usage: %s [--csv|--json] [--max-count N] [--max-quadratic N] [--max-bytes N] [--reps N] [--op NAME]\n", argv[0]);
+		return 1;
+	}
+
+	/// Returns 1 if [op] should run for [size]-byte elements and [count] items under [options], else 0.
+	static int bench_enabled(const bench_options* options, int op, size_t size, size_t count) {
+		if (options->only != NULL && strcmp(options->only, bench_names[op]) != 0)
+			return 0;
+		if (count * size > options->maxBytes)
+			return 0;
+		if ((op == BENCH_INSERT_FRONT || op == BENCH_INSERT_MIDDLE || op == BENCH_REMOVE_FRONT) && count > options->maxQuadratic)
+			return 0;
+		return 1;
+	}
+
+	/// Returns the number of repetitions for [count] items (more for small counts to get above timer noise).
+	static size_t bench_reps(const bench_options* options, size_t count) {
+		size_t reps = 100000 / count;
+		return (reps > options->reps)? reps : options->reps;
+	}
+
+	/// Fills [bytes] bytes of [data] with a fixed pseudo-random sequence (identical across programs).
+	static void bench_random(unsigned char* data, size_t bytes) {
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+		for (size_t i = 0; i < bytes; i++) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			data[i] = (unsigned char) state;
+		}
+	}
+
+	static void bench_header(const bench_options* options) {
+		if (!options->json)
+			printf("impl,op,elem_size,count,reps,total_ns,ns_per_item\n");
+	}
+
+	static void bench_report(const bench_options* options, const char* impl, int op, size_t size, size_t count, size_t reps, uint64_t ns) {
+		double perItem = (double) ns / (double) count;
+		if (options->json)
+			printf("{\"impl\":\"%s\",\"op\":\"%s\",\"elem_size\":%zu,\"count\":%zu,\"reps\":%zu,\"total_ns\":%llu,\"ns_per_item\":%.3f}\n",
+				impl, bench_names[op], size, count, reps, (unsigned long long) ns, perItem);
+		else
+			printf("%s,%s,%zu,%zu,%zu,%llu,%.3f\n", impl, bench_names[op], size, count, reps, (unsigned long long) ns, perItem);
+		fflush(stdout);
+	}
+#endif
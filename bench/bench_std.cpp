@@ -0,0 +1,101 @@
+/// 
+/// vectori.h Benchmarks: C++ std::vector baseline
+///		Same operations, sizes and counts as bench.c, on std::vector of a
+///		fixed-size trivially copyable element so the stride is a compile-time constant.
+/// 
+#include "bench.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+
+template <size_t N>
+struct bench_item {
+	unsigned char bytes[N];
+};
+
+static volatile size_t bench_sink;
+
+/// Returns the time in ns of one run of [op] on std::vector over [count] items from [items].
+template <size_t N>
+static uint64_t bench_std(int op, size_t count, const bench_item<N>* items) {
+	std::vector<bench_item<N> > v;
+	if (op != BENCH_PUSH_BACK && op != BENCH_INSERT_FRONT && op != BENCH_INSERT_MIDDLE)
+		v.assign(items, items + count);
+
+	size_t sink = 0;
+	uint64_t start = bench_now();
+	switch (op) {
+		case BENCH_PUSH_BACK:
+			for (size_t i = 0; i < count; i++)
+				v.push_back(items[i]);
+		break;
+		case BENCH_INSERT_FRONT:
+			for (size_t i = 0; i < count; i++)
+				v.insert(v.begin(), items[i]);
+		break;
+		case BENCH_INSERT_MIDDLE:
+			for (size_t i = 0; i < count; i++)
+				v.insert(v.begin() + (std::ptrdiff_t)(v.size() / 2), items[i]);
+		break;
+		case BENCH_REMOVE_FRONT:
+			for (size_t i = 0; i < count; i++)
+				v.erase(v.begin());
+		break;
+		case BENCH_GET:
+			for (size_t i = 0; i < count; i++)
+				sink += v[i].bytes[0];
+		break;
+		case BENCH_CLEAR:
+			std::fill(v.begin(), v.end(), items[0]);
+			v.clear();
+		break;
+		case BENCH_QSORT:
+			std::sort(v.begin(), v.end(), [](const bench_item<N>& a, const bench_item<N>& b) {
+				return memcmp(a.bytes, b.bytes, BENCH_KEY(N)) < 0;
+			});
+		break;
+		case BENCH_MAKESTR: {
+			std::string string(reinterpret_cast<const char*>(v.data()), v.size() * N);
+			sink += string.size();
+		} break;
+	}
+	uint64_t ns = bench_now() - start;
+
+	bench_sink += sink + v.size();
+	return ns;
+}
+
+template <size_t N>
+static void bench_size(const bench_options& options) {
+	for (size_t count = 100; count <= options.maxCount; count *= 10) {
+		if (count * N > options.maxBytes)
+			break;
+
+		std::vector<bench_item<N> > items(count);
+		bench_random(items.front().bytes, count * N);
+		for (int op = 0; op < BENCH_OPS; op++) {
+			if (!bench_enabled(&options, op, N, count))
+				continue;
+
+			size_t reps = bench_reps(&options, count);
+			uint64_t best = UINT64_MAX;
+			for (size_t r = 0; r < reps; r++)
+				best = std::min(best, bench_std<N>(op, count, items.data()));
+			bench_report(&options, "std_vector", op, N, count, reps, best);
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	bench_options options;
+	if (bench_parse(&options, argc, argv) != 0)
+		return 1;
+
+	bench_header(&options);
+	bench_size<1>(options);
+	bench_size<4>(options);
+	bench_size<16>(options);
+	bench_size<64>(options);
+	bench_size<256>(options);
+	return 0;
+}
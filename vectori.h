@@ -6,6 +6,8 @@
 	#include <string.h>
 	#include <stdbool.h>
 	#include <stdint.h>
+	#include <stdarg.h>
+	#include <stdio.h>
 	
 	#ifndef C_UNIFORM_TYPES
 	#define C_UNIFORM_TYPES
@@ -28,11 +30,13 @@
 	///		NOTE: Vector is not default initialized to zero,
 	///		call vector_clear(vector, clear_value) to do that.
 	///		
-	///		All operations will fail if memory is NOT allocated(reserved).
-	///		call vector_realloc() to allocate memory after creation.
+	///		All operations except inserts will fail if memory is NOT
+	///		allocated(reserved). Call vector_reserve() or vector_realloc()
+	///		to allocate memory after creation, or insert to allocate on demand.
 	///		
-	///		Will realloc and resize to [length * 2] when attempting
-	///		to insert a new element and iterator == length.
+	///		Will realloc and resize using the vector's growth policy when
+	///		attempting to insert a new element and iterator == length.
+	///		The default policy doubles the item capacity, see vector_setgrowth().
 	///		
 	///		Calling vector_clear(...) will clear all elements of the vector
 	///		to a specific element/value and reset the iterator to ZERO.
@@ -44,193 +48,3561 @@
 	///		with the intended length for new default sizes needed.
 	///		
 	///			#define vector_DEFAULT_LENGTH 32
+	///		
+	///		Define VECTOR_DEBUG before including to assert on NULL vectors,
+	///		rings and segmented vectors, NULL data, reversed [first, last)
+	///		ranges and out-of-bounds access through the unchecked accessors
+	///		(vector_get_unchecked, vector_at, typed _at). Without it the
+	///		unchecked accessors compile down to a single address computation.
+	///		
+	///		Define VECTOR_THREADS before including to enable the multi-threaded
+	///		features (pthreads, or Win32 threads on Windows, plus C11 atomics).
+	///		Without it they fall back to running on the calling thread and the
+	///		concurrent containers (vector_ring, vector_mt) are not available.
+	///		
+	///		Define VECTOR_MMAP before including to enable file-backed vectors
+	///		(vector_mmap_open, POSIX only).
+	///		
+	///		Define VECTOR_STATS before including to count reallocs, bytes moved
+	///		and peak capacity per vector (vector_stats_dump, vector_stats_listen).
 	/// 
 
+	#ifdef VECTOR_DEBUG
+		#include <assert.h>
+		#define VECTOR_ASSERT(X) assert(X)
+	#else
+		#define VECTOR_ASSERT(X) ((void_t)0)
+	#endif
+
 	/// Default item count for new vectors.
 	#ifndef VECTOR_DEFAULT_LENGTH
 		#define VECTOR_DEFAULT_LENGTH 32
 	#endif
 
+	/// Default item count added per growth by vector_grow_chunk.
+	#ifndef VECTOR_GROWTH_CHUNK
+		#define VECTOR_GROWTH_CHUNK VECTOR_DEFAULT_LENGTH
+	#endif
+
+	/// Cache line size (bytes) used to keep shared state apart.
+	#ifndef VECTOR_CACHE_LINE
+		#define VECTOR_CACHE_LINE 64
+	#endif
+
+	#define VECTOR_MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
+	#define VECTOR_MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+
+	/// SIMD instruction sets (define VECTOR_NO_SIMD to use the portable paths only).
+	#if !defined(VECTOR_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__))
+		#include <emmintrin.h>
+		#define VECTOR_SIMD_SSE2
+		#if defined(__GNUC__) || defined(__clang__)
+			#include <immintrin.h>
+			#define VECTOR_SIMD_AVX2
+		#endif
+	#elif !defined(VECTOR_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+		#include <arm_neon.h>
+		#define VECTOR_SIMD_NEON
+	#endif
+
+	/// 
+	/// Streaming Copies
+	///		Copies and fills of at least VECTOR_STREAM_THRESHOLD bytes (sized to
+	///		exceed a typical last-level cache) use non-temporal stores with
+	///		software prefetch on SSE2, so cloning or clearing a huge vector does
+	///		not evict the caller's hot working set. Smaller ones use memmove and
+	///		memcpy, which are faster while the data still fits in cache.
+	/// 
+	#ifndef VECTOR_STREAM_THRESHOLD
+		#define VECTOR_STREAM_THRESHOLD ((size_t) 8 << 20)
+	#endif
+
+	/// Bytes read ahead of the copy position by the streaming paths.
+	#ifndef VECTOR_PREFETCH_DISTANCE
+		#define VECTOR_PREFETCH_DISTANCE 512
+	#endif
+
+	/// Largest pattern period (lcm of the element size and 16 bytes) streamed by fills, larger ones use cached stores.
+	#ifndef VECTOR_STREAM_PATTERN
+		#define VECTOR_STREAM_PATTERN 4096
+	#endif
+
+	/// Copies [bytes] bytes from [src] to [dest] like memmove (the regions may overlap), streaming past VECTOR_STREAM_THRESHOLD.
+	void_t vector_move_bytes(void_t* dest, const void_t* src, size_t bytes) {
+		#ifdef VECTOR_SIMD_SSE2
+			uint08_t* d = (uint08_t*) dest;
+			const uint08_t* s = (const uint08_t*) src;
+			if (bytes >= VECTOR_STREAM_THRESHOLD && d != s) {
+				if (d < s || d >= s + bytes) {
+					// Forward: every store lands below the next load.
+					size_t i = (16 - ((uintptr_t) d & 15)) & 15;
+					memmove(d, s, i);
+					for (; i + 16 <= bytes; i += 16) {
+						_mm_prefetch((const char*)(s + i + VECTOR_PREFETCH_DISTANCE), _MM_HINT_NTA);
+						_mm_stream_si128((__m128i*)(d + i), _mm_loadu_si128((const __m128i*)(s + i)));
+					}
+					_mm_sfence();
+					memmove(d + i, s + i, bytes - i);
+				} else {
+					// Backward (dest overlaps above src): every store lands above the next load.
+					size_t i = bytes - ((uintptr_t)(d + bytes) & 15);
+					memmove(d + i, s + i, bytes - i);
+					for (; i >= 16; i -= 16) {
+						_mm_prefetch((const char*)(s + i - VECTOR_PREFETCH_DISTANCE), _MM_HINT_NTA);
+						_mm_stream_si128((__m128i*)(d + i - 16), _mm_loadu_si128((const __m128i*)(s + i - 16)));
+					}
+					_mm_sfence();
+					memmove(d, s, i);
+				}
+				return;
+			}
+		#endif
+		memmove(dest, src, bytes);
+	}
+
+	/// Copies [bytes] bytes from [src] to the non-overlapping [dest] like memcpy, streaming past VECTOR_STREAM_THRESHOLD.
+	void_t vector_copy_bytes(void_t* dest, const void_t* src, size_t bytes) {
+		if (bytes >= VECTOR_STREAM_THRESHOLD)
+			vector_move_bytes(dest, src, bytes);
+		else if (bytes > 0)
+			memcpy(dest, src, bytes);
+	}
+
+	/// 
+	/// Threads
+	///		Minimal portable thread layer used by the multi-threaded features.
+	///		vector_thread_run() runs [count] tasks of [taskSize] bytes each in
+	///		parallel (the calling thread takes the first task) and waits for all.
+	/// 
+	/// Thread entry point: [task] is passed through from the caller.
+	typedef void_t (*vector_thread_func)(void_t* task);
+
+	#ifdef VECTOR_THREADS
+		#include <stdatomic.h>
+		#if defined(_WIN32)
+			#include <windows.h>
+			typedef HANDLE vector_thread;
+		#else
+			#include <pthread.h>
+			#include <unistd.h>
+			typedef pthread_t vector_thread;
+		#endif
+
+		typedef struct vector_thread_start {
+			vector_thread_func func;
+			void_t* task;
+		} vector_thread_start;
+
+		#if defined(_WIN32)
+			DWORD WINAPI vector_thread_entry(LPVOID argument) {
+		#else
+			void_t* vector_thread_entry(void_t* argument) {
+		#endif
+			vector_thread_start start = *(vector_thread_start*) argument;
+			free(argument);
+			start.func(start.task);
+			return 0;
+		}
+
+		/// Returns TRUE if a new thread running func(task) was started, else FALSE.
+		bool_t vector_thread_create(vector_thread* thread, vector_thread_func func, void_t* task) {
+			vector_thread_start* start = (vector_thread_start*) malloc(sizeof(vector_thread_start));
+			if (start == NULL)
+				return false;
+
+			start->func = func;
+			start->task = task;
+			#if defined(_WIN32)
+				*thread = CreateThread(NULL, 0, vector_thread_entry, start, 0, NULL);
+				if (*thread != NULL) return true;
+			#else
+				if (pthread_create(thread, NULL, vector_thread_entry, start) == 0) return true;
+			#endif
+			free(start);
+			return false;
+		}
+
+		/// Waits for a thread started by vector_thread_create to finish.
+		void_t vector_thread_join(vector_thread thread) {
+			#if defined(_WIN32)
+				WaitForSingleObject(thread, INFINITE);
+				CloseHandle(thread);
+			#else
+				pthread_join(thread, NULL);
+			#endif
+		}
+
+		/// Returns the number of hardware threads available.
+		size_t vector_thread_count(void_t) {
+			#if defined(_WIN32)
+				SYSTEM_INFO info;
+				GetSystemInfo(&info);
+				return VECTOR_MAX((size_t)info.dwNumberOfProcessors, 1);
+			#else
+				long count = sysconf(_SC_NPROCESSORS_ONLN);
+				return (count > 0)? (size_t)count : 1;
+			#endif
+		}
+
+		#if defined(_WIN32)
+			typedef CRITICAL_SECTION vector_mutex;
+			typedef CONDITION_VARIABLE vector_cond;
+			#define vector_mutex_init(M) InitializeCriticalSection(M)
+			#define vector_mutex_destroy(M) DeleteCriticalSection(M)
+			#define vector_mutex_lock(M) EnterCriticalSection(M)
+			#define vector_mutex_unlock(M) LeaveCriticalSection(M)
+			#define vector_cond_init(C) InitializeConditionVariable(C)
+			#define vector_cond_destroy(C) ((void_t)(C))
+			#define vector_cond_wait(C, M) SleepConditionVariableCS((C), (M), INFINITE)
+			#define vector_cond_broadcast(C) WakeAllConditionVariable(C)
+		#else
+			typedef pthread_mutex_t vector_mutex;
+			typedef pthread_cond_t vector_cond;
+			#define vector_mutex_init(M) pthread_mutex_init((M), NULL)
+			#define vector_mutex_destroy(M) pthread_mutex_destroy(M)
+			#define vector_mutex_lock(M) pthread_mutex_lock(M)
+			#define vector_mutex_unlock(M) pthread_mutex_unlock(M)
+			#define vector_cond_init(C) pthread_cond_init((C), NULL)
+			#define vector_cond_destroy(C) pthread_cond_destroy(C)
+			#define vector_cond_wait(C, M) pthread_cond_wait((C), (M))
+			#define vector_cond_broadcast(C) pthread_cond_broadcast(C)
+		#endif
+	#else
+		/// Returns the number of hardware threads available (1 without VECTOR_THREADS).
+		size_t vector_thread_count(void_t) {
+			return 1;
+		}
+	#endif
+
+	/// Runs func on [count] tasks laid out [taskSize] bytes apart in parallel and waits for all of them.
+	void_t vector_thread_run(vector_thread_func func, void_t* tasks, size_t taskSize, size_t count) {
+		#ifdef VECTOR_THREADS
+			vector_thread threads[64];
+			bool_t started[64];
+			for (size_t first = 0; first < count; first += 64) {
+				size_t batch = VECTOR_MIN(count - first, 64);
+				for (size_t i = 1; i < batch; i++)
+					started[i] = vector_thread_create(&threads[i], func, (int08_t*)tasks + (first + i) * taskSize);
+
+				func((int08_t*)tasks + first * taskSize);
+				for (size_t i = 1; i < batch; i++) {
+					if (started[i]) vector_thread_join(threads[i]);
+					else func((int08_t*)tasks + (first + i) * taskSize);
+				}
+			}
+		#else
+			for (size_t i = 0; i < count; i++)
+				func((int08_t*)tasks + i * taskSize);
+		#endif
+	}
+
+	/// Growth policy: returns the new item capacity for a vector of [capacity] items that needs room for [required] items.
+	///		Results smaller than [required] are raised to [required].
+	typedef size_t (*vector_growth)(size_t capacity, size_t required);
+
+	/// 
+	/// Allocators
+	///		Vectors allocate through an optional allocator vtable attached at
+	///		creation time (vector_calloc3). NULL uses calloc/realloc/free.
+	///		The allocator must outlive every vector (and string) created from it.
+	///		
+	///		vector_arena:	bump allocator, release all vectors with one vector_arena_reset().
+	///		vector_pool:	fixed-size block allocator, vectors are limited to blockSize bytes.
+	///		vector_aligned():	aligned_alloc backend, data stays aligned across growth (copy-on-grow).
+	///		vector_pages:	anonymous mmap backend with huge pages and NUMA placement (VECTOR_MMAP).
+	/// 
+	typedef struct vector_allocator {
+		void_t* (*allocate)(void_t* context, size_t size); // Returns new memory of [size] bytes or NULL.
+		void_t* (*reallocate)(void_t* context, void_t* data, size_t oldSize, size_t newSize); // Returns resized memory or NULL (data left untouched).
+		void_t (*release)(void_t* context, void_t* data, size_t size); // Releases memory returned by allocate/reallocate.
+		void_t* context; // User Context (passed to every call)
+		bool_t zeroed;   // TRUE if allocate always returns zeroed memory (vector_mem_alloc skips the memset)
+	} vector_allocator;
+
+	/// Returns zeroed memory of [size] bytes from [allocator] (calloc if NULL), or NULL.
+	void_t* vector_mem_alloc(vector_allocator* allocator, size_t size) {
+		if (allocator == NULL)
+			return calloc(1, size);
+
+		void_t* data = allocator->allocate(allocator->context, size);
+		if (data != NULL && !allocator->zeroed) memset(data, 0, size);
+		return data;
+	}
+
+	/// Returns [data] resized from [oldSize] to [newSize] bytes by [allocator] (realloc if NULL), or NULL.
+	void_t* vector_mem_realloc(vector_allocator* allocator, void_t* data, size_t oldSize, size_t newSize) {
+		if (allocator == NULL)
+			return realloc(data, newSize);
+
+		if (data == NULL)
+			return allocator->allocate(allocator->context, newSize);
+
+		return allocator->reallocate(allocator->context, data, oldSize, newSize);
+	}
+
+	/// Releases [data] of [size] bytes back to [allocator] (free if NULL).
+	void_t vector_mem_free(vector_allocator* allocator, void_t* data, size_t size) {
+		if (allocator == NULL)
+			free(data);
+		else if (data != NULL)
+			allocator->release(allocator->context, data, size);
+	}
+
+	/// Bump arena: allocations are carved linearly from one buffer and released together on reset.
+	typedef struct vector_arena {
+		vector_allocator allocator; // Pass &arena.allocator to vector_calloc3()
+		int08_t* buffer; // Arena Memory
+		size_t size;     // Arena Size (Bytes)
+		size_t offset;   // Bump Offset (Bytes)
+		size_t last;     // Offset of the most recent allocation (can grow/shrink in place)
+		bool_t owned;    // TRUE if buffer was allocated by vector_arena_init
+	} vector_arena;
+
+	/// Alignment of every arena allocation.
+	#define VECTOR_ARENA_ALIGN 16
+
+	void_t* vector_arena_allocate(void_t* context, size_t size) {
+		vector_arena* arena = (vector_arena*) context;
+		size_t offset = (arena->offset + (VECTOR_ARENA_ALIGN - 1)) & ~(size_t)(VECTOR_ARENA_ALIGN - 1);
+		if (offset > arena->size || size > arena->size - offset)
+			return NULL;
+
+		arena->last = offset;
+		arena->offset = offset + size;
+		return arena->buffer + offset;
+	}
+
+	void_t* vector_arena_reallocate(void_t* context, void_t* data, size_t oldSize, size_t newSize) {
+		vector_arena* arena = (vector_arena*) context;
+		if ((int08_t*)data == arena->buffer + arena->last) {
+			if (newSize > arena->size - arena->last)
+				return NULL;
+
+			arena->offset = arena->last + newSize;
+			return data;
+		}
+
+		void_t* moved = vector_arena_allocate(context, newSize);
+		if (moved != NULL) vector_copy_bytes(moved, data, VECTOR_MIN(oldSize, newSize));
+		return moved;
+	}
+
+	void_t vector_arena_release(void_t* context, void_t* data, size_t size) {
+		vector_arena* arena = (vector_arena*) context;
+		if ((int08_t*)data == arena->buffer + arena->last && arena->last + size == arena->offset)
+			arena->offset = arena->last;
+	}
+
+	/// Returns TRUE if the arena was initialized over [buffer] (or a malloc'd buffer if NULL) of [size] bytes, else FALSE.
+	bool_t vector_arena_init(vector_arena* arena, void_t* buffer, size_t size) {
+		arena->owned = (buffer == NULL);
+		arena->buffer = (int08_t*)((buffer != NULL)? buffer : malloc(size));
+		arena->size = (arena->buffer != NULL)? size : 0;
+		arena->offset = arena->last = 0;
+		arena->allocator = (vector_allocator) { vector_arena_allocate, vector_arena_reallocate, vector_arena_release, arena, false };
+		return arena->buffer != NULL;
+	}
+
+	/// Releases every allocation made from the arena at once. Vectors using it must not be accessed or free'd afterwards.
+	void_t vector_arena_reset(vector_arena* arena) {
+		arena->offset = arena->last = 0;
+	}
+
+	/// Frees the arena buffer (if owned by the arena).
+	void_t vector_arena_free(vector_arena* arena) {
+		if (arena->owned) free(arena->buffer);
+		arena->buffer = NULL;
+		arena->size = arena->offset = arena->last = 0;
+	}
+
+	/// Block pool: fixed-size blocks handed out from an intrusive free list.
+	typedef struct vector_pool {
+		vector_allocator allocator; // Pass &pool.allocator to vector_calloc3()
+		int08_t* buffer;   // Pool Memory
+		size_t blockSize;  // Block Size (Bytes)
+		size_t blockCount; // Block Count
+		void_t* freeList;  // Next Free Block
+		bool_t owned;      // TRUE if buffer was allocated by vector_pool_init
+	} vector_pool;
+
+	void_t* vector_pool_allocate(void_t* context, size_t size) {
+		vector_pool* pool = (vector_pool*) context;
+		void_t* block = pool->freeList;
+		if (size > pool->blockSize || block == NULL)
+			return NULL;
+
+		memcpy(&pool->freeList, block, sizeof(void_t*));
+		return block;
+	}
+
+	void_t* vector_pool_reallocate(void_t* context, void_t* data, size_t oldSize, size_t newSize) {
+		vector_pool* pool = (vector_pool*) context;
+		(void_t) oldSize;
+		return (newSize <= pool->blockSize)? data : NULL;
+	}
+
+	void_t vector_pool_release(void_t* context, void_t* data, size_t size) {
+		vector_pool* pool = (vector_pool*) context;
+		(void_t) size;
+		memcpy(data, &pool->freeList, sizeof(void_t*));
+		pool->freeList = data;
+	}
+
+	/// Returns every block of the pool to its free list at once. Vectors using it must not be accessed or free'd afterwards.
+	void_t vector_pool_reset(vector_pool* pool) {
+		pool->freeList = NULL;
+		for (size_t i = pool->blockCount; i > 0; i--)
+			vector_pool_release(pool, pool->buffer + (i - 1) * pool->blockSize, pool->blockSize);
+	}
+
+	/// Returns TRUE if the pool was initialized with [blockCount] blocks of [blockSize] bytes over [buffer] (or a malloc'd buffer if NULL), else FALSE.
+	bool_t vector_pool_init(vector_pool* pool, size_t blockSize, size_t blockCount, void_t* buffer) {
+		blockSize = (VECTOR_MAX(blockSize, sizeof(void_t*)) + (VECTOR_ARENA_ALIGN - 1)) & ~(size_t)(VECTOR_ARENA_ALIGN - 1);
+		pool->owned = (buffer == NULL);
+		pool->buffer = (int08_t*)((buffer != NULL)? buffer : malloc(blockSize * blockCount));
+		pool->blockSize = blockSize;
+		pool->blockCount = (pool->buffer != NULL)? blockCount : 0;
+		pool->allocator = (vector_allocator) { vector_pool_allocate, vector_pool_reallocate, vector_pool_release, pool, false };
+		vector_pool_reset(pool);
+		return pool->buffer != NULL;
+	}
+
+	/// Frees the pool buffer (if owned by the pool).
+	void_t vector_pool_free(vector_pool* pool) {
+		if (pool->owned) free(pool->buffer);
+		pool->buffer = NULL;
+		pool->freeList = NULL;
+		pool->blockCount = 0;
+	}
+
+	void_t* vector_aligned_allocate(void_t* context, size_t size) {
+		size_t alignment = *(const size_t*) context;
+		#if defined(_MSC_VER)
+			return _aligned_malloc(size, alignment);
+		#else
+			return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+		#endif
+	}
+
+	void_t vector_aligned_release(void_t* context, void_t* data, size_t size) {
+		(void_t) context;
+		(void_t) size;
+		#if defined(_MSC_VER)
+			_aligned_free(data);
+		#else
+			free(data);
+		#endif
+	}
+
+	void_t* vector_aligned_reallocate(void_t* context, void_t* data, size_t oldSize, size_t newSize) {
+		void_t* moved = vector_aligned_allocate(context, newSize);
+		if (moved != NULL) {
+			vector_copy_bytes(moved, data, VECTOR_MIN(oldSize, newSize));
+			vector_aligned_release(context, data, oldSize);
+		}
+		return moved;
+	}
+
+	/// Largest supported alignment is 1 << (VECTOR_ALIGNMENTS - 1) bytes (2 MB).
+	#define VECTOR_ALIGNMENTS 22
+	#define VECTOR_ALIGNED_ENTRY(K) { vector_aligned_allocate, vector_aligned_reallocate, vector_aligned_release, (void_t*) &vector_aligned_sizes[K], false }
+
+	const size_t vector_aligned_sizes[VECTOR_ALIGNMENTS] = {
+		1u << 0, 1u << 1, 1u << 2, 1u << 3, 1u << 4, 1u << 5, 1u << 6, 1u << 7, 1u << 8, 1u << 9, 1u << 10,
+		1u << 11, 1u << 12, 1u << 13, 1u << 14, 1u << 15, 1u << 16, 1u << 17, 1u << 18, 1u << 19, 1u << 20, 1u << 21
+	};
+
+	vector_allocator vector_aligned_allocators[VECTOR_ALIGNMENTS] = {
+		VECTOR_ALIGNED_ENTRY(0), VECTOR_ALIGNED_ENTRY(1), VECTOR_ALIGNED_ENTRY(2), VECTOR_ALIGNED_ENTRY(3), VECTOR_ALIGNED_ENTRY(4),
+		VECTOR_ALIGNED_ENTRY(5), VECTOR_ALIGNED_ENTRY(6), VECTOR_ALIGNED_ENTRY(7), VECTOR_ALIGNED_ENTRY(8), VECTOR_ALIGNED_ENTRY(9),
+		VECTOR_ALIGNED_ENTRY(10), VECTOR_ALIGNED_ENTRY(11), VECTOR_ALIGNED_ENTRY(12), VECTOR_ALIGNED_ENTRY(13), VECTOR_ALIGNED_ENTRY(14),
+		VECTOR_ALIGNED_ENTRY(15), VECTOR_ALIGNED_ENTRY(16), VECTOR_ALIGNED_ENTRY(17), VECTOR_ALIGNED_ENTRY(18), VECTOR_ALIGNED_ENTRY(19),
+		VECTOR_ALIGNED_ENTRY(20), VECTOR_ALIGNED_ENTRY(21)
+	};
+
+	/// Returns the shared allocator whose memory is aligned to [alignment] bytes (power of two up to 2 MB), or NULL if unsupported.
+	vector_allocator* vector_aligned(size_t alignment) {
+		for (size_t i = 0; i < VECTOR_ALIGNMENTS; i++)
+			if (vector_aligned_sizes[i] == alignment)
+				return &vector_aligned_allocators[i];
+		return NULL;
+	}
+
+	/// Storage flags of a vector.
+	#define VECTOR_FLAG_INLINE 0x1u // Data is a caller/inline buffer that is not owned: spills to the allocator on growth.
+	#define VECTOR_FLAG_MAPPED 0x2u // Data is a file mapping owned by a vector_mmap_file allocator (see vector_mmap_open).
+	#define VECTOR_FLAG_DEQUE 0x4u // Inserts/removes in the front half shift the front elements into headroom (see vector_setdeque).
+
+	#ifdef VECTOR_STATS
+		struct vector;
+
+		/// Growth event hook: [oldLength] and [newLength] are byte capacities, [context] is passed through from vector_stats_listen.
+		typedef void_t (*vector_stats_callback)(const struct vector* vector, size_t oldLength, size_t newLength, void_t* context);
+
+		/// Per-vector instrumentation counters (VECTOR_STATS only).
+		typedef struct vector_stats {
+			size_t reallocs;   // Successful vector_realloc calls (growth and shrink)
+			size_t bytesMoved; // Bytes shifted by memmove/memcpy in insert/remove
+			size_t peakLength; // Largest byte capacity held
+			size_t peakCount;  // Largest item count held
+		} vector_stats;
+
+		vector_stats_callback vector_stats_hook = NULL;
+		void_t* vector_stats_context = NULL;
+
+		#define VECTOR_STATS_MOVED(vector, bytes) ((vector)->stats.bytesMoved += (bytes))
+		#define VECTOR_STATS_COUNT(vector) ((vector)->stats.peakCount = VECTOR_MAX((vector)->stats.peakCount, (vector)->iterator / (vector)->typeSize))
+	#else
+		#define VECTOR_STATS_MOVED(vector, bytes) ((void_t)0)
+		#define VECTOR_STATS_COUNT(vector) ((void_t)0)
+	#endif
+
+	/// Reference count of a buffer shared between vector handles by vector_share (atomic with VECTOR_THREADS).
+	///		Always malloc'd, independent of the vector's allocator.
+	#ifdef VECTOR_THREADS
+		typedef atomic_size_t vector_refcount;
+		#define vector_refcount_init(R, N) atomic_init((R), (N))
+		#define vector_refcount_load(R) atomic_load_explicit((R), memory_order_acquire)
+		#define vector_refcount_add(R) atomic_fetch_add_explicit((R), 1, memory_order_relaxed)
+		#define vector_refcount_sub(R) atomic_fetch_sub_explicit((R), 1, memory_order_acq_rel)
+	#else
+		typedef size_t vector_refcount;
+		#define vector_refcount_init(R, N) (*(R) = (N))
+		#define vector_refcount_load(R) (*(R))
+		#define vector_refcount_add(R) ((*(R))++)
+		#define vector_refcount_sub(R) ((*(R))--)
+	#endif
+
 	/// Vector with internal iterator that accepts void* (generic) data with byte-size typeSize.
 	typedef struct vector {
 		int32_t typeSize; // Type Size (Byte Length)
 		size_t length;   // Current Size (Bytes, not Items)
 		size_t iterator; // Current Iterator (Bytes, not Items)
 		void_t* data; // Data Pointer
+		vector_growth growth; // Growth Policy (NULL for vector_grow_double)
+		vector_allocator* allocator; // Allocator (NULL for calloc/realloc/free)
+		uint32_t flags; // Storage Flags (VECTOR_FLAG_*)
+		vector_refcount* shared; // Shared Buffer References (NULL if owned alone, see vector_share)
+		size_t front; // Headroom Before Data (Bytes, allocation starts at data - front)
+		#ifdef VECTOR_STATS
+			vector_stats stats; // Instrumentation Counters
+		#endif
 	} vector;
 
-	#define VECTOR_MIN(X, Y) (((X) < (Y)) ? (X) : (Y))
-	#define VECTOR_MAX(X, Y) (((X) > (Y)) ? (X) : (Y))
+	/// Returns a new vector (with memory allocated from [allocator] if reserved is TRUE): NULL allocator uses calloc.
+	vector vector_calloc3(int32_t typeSize, size_t length, bool_t reserve, vector_allocator* allocator) {
+		size_t len = (size_t)((reserve?1:0) * length);
+		void_t* data = (len > 0)? vector_mem_alloc(allocator, len * (size_t)typeSize) : NULL;
+		return (vector) { .typeSize = typeSize, .length = (data != NULL)? len * (size_t)typeSize : 0, .data = data, .allocator = allocator };
+	}
+
+	/// Returns a new vector with uninitialized memory for [length] items from [allocator] (NULL uses malloc).
+	///		Skips the zeroing (and the up-front page faults) of vector_calloc3 for vectors that are written right away,
+	///		e.g. through vector_resize_uninit. The elements are undefined until written.
+	vector vector_malloc(int32_t typeSize, size_t length, vector_allocator* allocator) {
+		void_t* data = (length > 0)? vector_mem_realloc(allocator, NULL, 0, length * (size_t)typeSize) : NULL;
+		return (vector) { .typeSize = typeSize, .length = (data != NULL)? length * (size_t)typeSize : 0, .data = data, .allocator = allocator };
+	}
+
+	/// Returns a new vector that stores its elements in [buffer] of [bytes] bytes until it overflows to [allocator] (NULL uses realloc).
+	///		The buffer is not owned by the vector and is never free'd by it.
+	vector vector_calloc_inline(int32_t typeSize, void_t* buffer, size_t bytes, vector_allocator* allocator) {
+		return (vector) { .typeSize = typeSize, .length = (bytes / (size_t)typeSize) * (size_t)typeSize, .data = buffer, .allocator = allocator, .flags = VECTOR_FLAG_INLINE };
+	}
 
 	/// Returns a new vector (with memory allocated if reserved is TRUE) with default length vector_DEFAULT_LENGTH.
 	vector vector_calloc(int32_t typeSize, bool_t reserve) {
-		size_t len = (size_t)(reserve * VECTOR_DEFAULT_LENGTH);
-		return (vector) { typeSize, len * typeSize, 0, (reserve)? calloc(len, typeSize) : NULL };
+		return vector_calloc3(typeSize, VECTOR_DEFAULT_LENGTH, reserve, NULL);
 	}
 
 	/// Returns a new vector (with memory allocated if reserved is TRUE).
 	vector vector_calloc2(int32_t typeSize, size_t length, bool_t reserve) {
-		size_t len = (size_t)((reserve?1:0) * length);
-		return (vector) { typeSize, len * (size_t)typeSize, 0, (reserve)? calloc(len, typeSize) : NULL };
+		return vector_calloc3(typeSize, length, reserve, NULL);
+	}
+
+	/// Returns a new vector whose data is aligned to [alignment] bytes (power of two, e.g. 32/64/4096) for its whole lifetime:
+	///		growth allocates a new aligned block and copies (vector_aligned), so the alignment survives every realloc.
+	///		An unsupported alignment returns an unallocated vector (data and allocator NULL).
+	vector vector_calloc_aligned(int32_t typeSize, size_t length, bool_t reserve, size_t alignment) {
+		vector_allocator* allocator = vector_aligned(alignment);
+		VECTOR_ASSERT(allocator != NULL);
+		if (allocator == NULL)
+			return (vector) { .typeSize = typeSize };
+		return vector_calloc3(typeSize, length, reserve, allocator);
 	}
 
+	/// Returns a new deque-mode vector (see vector_setdeque) with room for [length] items from [allocator] (NULL uses calloc),
+	///		half of it kept as headroom before the first element.
+	vector vector_calloc_deque(int32_t typeSize, size_t length, vector_allocator* allocator) {
+		vector result = vector_calloc3(typeSize, length, true, allocator);
+		result.flags |= VECTOR_FLAG_DEQUE;
+		if (result.data != NULL) {
+			result.front = (length / 2) * (size_t)typeSize;
+			result.data = (int08_t*)result.data + result.front;
+			result.length -= result.front;
+		}
+		return result;
+	}
+
+	#ifdef VECTOR_STATS
+		/// Records a capacity change from [oldLength] bytes and notifies the vector_stats_listen hook.
+		void_t vector_stats_realloc(vector* vector, size_t oldLength) {
+			vector->stats.reallocs++;
+			vector->stats.peakLength = VECTOR_MAX(vector->stats.peakLength, vector->length);
+			if (vector_stats_hook != NULL)
+				vector_stats_hook(vector, oldLength, vector->length, vector_stats_context);
+		}
+	#endif
+
+	/// Returns TRUE if the vector owns its buffer alone, taking a private copy with [length] bytes of capacity if it is still
+	///		shared with other handles (the last handle just drops the reference count), else FALSE if the copy failed.
+	bool_t vector_unshare_into(vector* vector, size_t length) {
+		vector_refcount* shared = vector->shared;
+		if (shared == NULL)
+			return true;
+
+		if (vector_refcount_load(shared) > 1) {
+			void_t* data = vector_mem_realloc(vector->allocator, NULL, 0, length);
+			if (data == NULL)
+				return false;
+
+			vector_copy_bytes(data, vector->data, VECTOR_MIN(vector->iterator, length));
+			vector->shared = NULL;
+			if (vector_refcount_sub(shared) == 1) {
+				// Every other handle was free'd while copying: this was the last reference.
+				vector_mem_free(vector->allocator, (int08_t*)vector->data - vector->front, vector->front + vector->length);
+				free(shared);
+			}
+
+			vector->data = data;
+			vector->front = 0;
+			VECTOR_STATS_MOVED(vector, VECTOR_MIN(vector->iterator, length));
+			#ifdef VECTOR_STATS
+				size_t oldLength = vector->length;
+				vector->length = length;
+				vector_stats_realloc(vector, oldLength);
+			#else
+				vector->length = length;
+			#endif
+			vector->iterator = VECTOR_MIN(vector->iterator, length);
+			return true;
+		}
+
+		free(shared);
+		vector->shared = NULL;
+		return true;
+	}
+
+	/// Returns TRUE if the vector owns its buffer alone (copy-on-first-write of a vector_share'd buffer), else FALSE.
+	///		Mutating functions call this themselves: call it before writing through pointers from vector_get or vector_at.
+	bool_t vector_unshare(vector* vector) {
+		return vector_unshare_into(vector, vector->length);
+	}
+
+	/// Evaluates to TRUE if the vector may be written in place (unsharing it first if needed).
+	#define VECTOR_WRITABLE(vector) ((vector)->shared == NULL || vector_unshare(vector))
+
+	/// Returns a handle sharing the elements of [source] in O(1) (copy-on-write): neither handle sees the other's later writes,
+	///		the first write to either copies the buffer. Every handle must be vector_free'd. Inline and file-backed vectors,
+	///		whose buffers are not reference counted, are deep-copied instead.
+	vector vector_share(vector* source) {
+		VECTOR_ASSERT(source != NULL);
+		vector handle = *source;
+		if (source->data == NULL)
+			return handle;
+
+		if (!(source->flags & (VECTOR_FLAG_INLINE | VECTOR_FLAG_MAPPED))) {
+			if (source->shared == NULL) {
+				source->shared = (vector_refcount*) malloc(sizeof(vector_refcount));
+				if (source->shared != NULL)
+					vector_refcount_init(source->shared, 1);
+			}
+
+			if (source->shared != NULL) {
+				vector_refcount_add(source->shared);
+				handle.shared = source->shared;
+				return handle;
+			}
+		}
+
+		vector_allocator* allocator = (source->flags & VECTOR_FLAG_MAPPED)? NULL : source->allocator;
+		handle = vector_calloc3(source->typeSize, source->length / source->typeSize, true, allocator);
+		handle.growth = source->growth;
+		if (handle.data != NULL) {
+			vector_copy_bytes(handle.data, source->data, source->iterator);
+			handle.iterator = source->iterator;
+		}
+		return handle;
+	}
+
+	#ifdef VECTOR_MMAP
+		bool_t vector_mmap_close(vector* vector);
+	#endif
+
 	/// Returns TRUE if the vector was free'd, else FALSE if the vector passed is not allocated.
 	bool_t vector_free(vector* vector) {
+		#ifdef VECTOR_MMAP
+			if (vector != NULL && (vector->flags & VECTOR_FLAG_MAPPED))
+				return vector_mmap_close(vector);
+		#endif
+
 		if (vector == NULL || vector->data == NULL) return false;
-		free(vector->data);
+		bool_t owner = !(vector->flags & VECTOR_FLAG_INLINE);
+		if (vector->shared != NULL) {
+			owner = vector_refcount_sub(vector->shared) == 1;
+			if (owner)
+				free(vector->shared);
+			vector->shared = NULL;
+		}
+
+		if (owner)
+			vector_mem_free(vector->allocator, (int08_t*)vector->data - vector->front, vector->front + vector->length);
+
+		vector->flags &= ~VECTOR_FLAG_INLINE;
 		vector->data = NULL;
+		vector->length = vector->iterator = vector->front = 0;
 		return true;
 	}
 
 	/// Attempts to resize the vector: Returns true if the vector is allocated (regardless if it was resized), else FALSE.
 	bool_t vector_realloc(vector* vector, size_t length) {
-		void_t* data = realloc(vector->data, length * vector->typeSize);
+		VECTOR_ASSERT(vector != NULL);
+		if (length == 0)
+			return false;
 
-		if (data != NULL) {
-			vector->data = data;
-			vector->length = length * vector->typeSize;
+		if (vector->shared != NULL) {
+			if (!vector_unshare_into(vector, length * vector->typeSize))
+				return false;
+			if (vector->length == length * vector->typeSize)
+				return true;
+		}
+
+		if (vector->flags & VECTOR_FLAG_INLINE) {
+			if (length * vector->typeSize <= vector->length)
+				return true;
+
+			void_t* heap = vector_mem_realloc(vector->allocator, NULL, 0, length * vector->typeSize);
+			if (heap == NULL)
+				return false;
+
+			vector_copy_bytes(heap, vector->data, vector->iterator);
+			vector->flags &= ~VECTOR_FLAG_INLINE;
+			vector->data = heap;
+			vector->front = 0;
+			#ifdef VECTOR_STATS
+				size_t oldLength = vector->length;
+				vector->length = length * vector->typeSize;
+				vector_stats_realloc(vector, oldLength);
+			#else
+				vector->length = length * vector->typeSize;
+			#endif
 			return true;
 		}
 
-		return false;
-	}
+		int08_t* base = (vector->data != NULL)? (int08_t*)vector->data - vector->front : NULL;
+		vector->front = (base != NULL)? vector->front : 0;
+		void_t* data = vector_mem_realloc(vector->allocator, base, (base != NULL)? vector->front + vector->length : 0, vector->front + length * vector->typeSize);
 
-	/// Returns TRUE if the vector is allocated, else FALSE.
-	bool_t vector_isalloc(vector* vector) {
-		return &vector->data != NULL;
-	}
+		if (data != NULL) {
+			vector->data = (int08_t*)data + vector->front;
+			#ifdef VECTOR_STATS
+				size_t oldLength = vector->length;
+				vector->length = length * vector->typeSize;
+				vector_stats_realloc(vector, oldLength);
+			#else
+				vector->length = length * vector->typeSize;
+			#endif
+			vector->iterator = VECTOR_MIN(vector->iterator, vector->length);
+			return true;
+		}
 
-	/// Returns the full byte-length of allocated memory for a vector.
-	size_t vector_bytesize(vector* vector) {
-		return vector->length;
+		return false;
 	}
 
-	/// Returns the maximum number of elements that can be written (until resized on insert).
-	size_t vector_maxsize(vector* vector) {
-		return vector->length / vector->typeSize;
+	/// Growth policy that doubles the item capacity (default).
+	size_t vector_grow_double(size_t capacity, size_t required) {
+		return (capacity > 0)? capacity << 1 : VECTOR_MAX(required, VECTOR_DEFAULT_LENGTH);
 	}
 
-	/// Returns the byte-size of the type used for allocations within a vector.
-	size_t vector_typesize(vector* vector) {
-		return vector->typeSize;
+	/// Growth policy that grows the item capacity by half (1.5x).
+	size_t vector_grow_half(size_t capacity, size_t required) {
+		return (capacity > 1)? capacity + (capacity >> 1) : VECTOR_MAX(required, VECTOR_DEFAULT_LENGTH);
 	}
 
-	/// Returns the item length of a vector.
-	size_t vector_length(vector* vector) {
-		return (vector->length / vector->typeSize);
+	/// Growth policy that adds a fixed chunk of VECTOR_GROWTH_CHUNK items.
+	size_t vector_grow_chunk(size_t capacity, size_t required) {
+		(void_t) required;
+		return capacity + VECTOR_GROWTH_CHUNK;
 	}
 
-	/// Returns the item count (same-as last iterator position) of a vector.
-	size_t vector_count(vector* vector) {
-		return (vector->iterator / vector->typeSize);
+	/// Sets the growth policy of a vector (NULL restores the default vector_grow_double).
+	void_t vector_setgrowth(vector* vector, vector_growth growth) {
+		vector->growth = growth;
 	}
 
-	/// Returns FALSE if [iterator] is not within bounds length >= iterator >= 0, else TRUE and set new iterator position.
-	bool_t vector_move(vector* vector, size_t iterator) {
-		if (&vector->data == NULL || (iterator * vector->typeSize) < 0 || (iterator*vector->typeSize) > vector->length)
+	/// Returns TRUE if there is room for [length] items after data and at least one free slot at each end, else FALSE.
+	///		Deque vectors at most half full are recentered in place, else moved into a buffer grown by the growth policy
+	///		(to at least twice [length]); either way the spare capacity is split evenly between both ends.
+	bool_t vector_deque_recenter(vector* vector, size_t length) {
+		if (!VECTOR_WRITABLE(vector))
 			return false;
 
-		vector->iterator = iterator * vector->typeSize;
-		return true;
-	}
+		size_t typeSize = vector->typeSize, count = vector->iterator / typeSize;
+		size_t total = (vector->data != NULL)? (vector->front + vector->length) / typeSize : 0;
+		int08_t* base = (vector->data != NULL)? (int08_t*)vector->data - vector->front : NULL;
+		if (base != NULL && 2 * length <= total) {
+			size_t front = ((total - count) / 2) * typeSize;
+			vector_move_bytes(base + front, vector->data, vector->iterator);
+			VECTOR_STATS_MOVED(vector, vector->iterator);
+			vector->data = base + front;
+			vector->length = total * typeSize - front;
+			vector->front = front;
+			return true;
+		}
 
-	/// Returns TRUE if the vector can be cleared, else FALSE.
-	bool_t vector_clear(vector* vector, void_t* data) {
-		if (&vector->data == NULL || vector->length <= 0)
+		size_t grown = ((vector->growth != NULL)? vector->growth : vector_grow_double)(total, length);
+		grown = VECTOR_MAX(grown, 2 * length);
+		int08_t* heap = (int08_t*) vector_mem_realloc(vector->allocator, NULL, 0, grown * typeSize);
+		if (heap == NULL)
 			return false;
 
-		for(size_t i = 0; i < vector->length; i += vector->typeSize)
-			memcpy((int08_t*)vector->data + i, data, vector->typeSize);
+		size_t front = ((grown - count) / 2) * typeSize;
+		if (vector->iterator > 0)
+			vector_copy_bytes(heap + front, vector->data, vector->iterator);
+		if (base != NULL && !(vector->flags & VECTOR_FLAG_INLINE))
+			vector_mem_free(vector->allocator, base, vector->front + vector->length);
 
-		vector->iterator = 0;
+		size_t oldLength = vector->length;
+		vector->flags &= ~VECTOR_FLAG_INLINE;
+		vector->data = heap + front;
+		vector->length = grown * typeSize - front;
+		vector->front = front;
+		#ifdef VECTOR_STATS
+			vector_stats_realloc(vector, oldLength);
+		#else
+			(void_t) oldLength;
+		#endif
 		return true;
 	}
 
-	/// Returns TRUE if the vector is allocated and the element at [index] can be written, else FALSE.
-	bool_t vector_insert(vector* vector, void_t* data, size_t index) {
-		size_t byteIndex = index * vector->typeSize;
+	/// Moves the elements to the start of the allocation so all headroom becomes spare capacity after the elements.
+	void_t vector_drop_front(vector* vector) {
+		if (vector->front == 0 || vector->data == NULL)
+			return;
 
-		if (vector->iterator == vector->length)
-			vector_realloc(vector, vector->length << 1);
+		int08_t* base = (int08_t*)vector->data - vector->front;
+		vector_move_bytes(base, vector->data, vector->iterator);
+		vector->data = base;
+		vector->length += vector->front;
+		vector->front = 0;
+	}
 
-		if (&vector->data == NULL || byteIndex < 0 || byteIndex > vector->iterator)
+	/// Returns TRUE if the deque mode of a vector was switched on or off, else FALSE (file-backed vectors, or unsharing failed).
+	///		In deque mode inserts and removes in the front half of the vector shift the front elements into headroom kept
+	///		before data instead of shifting the tail, so pushing and popping at index 0 is amortized O(1). Indexing is
+	///		unchanged. Turning it off moves the elements back to the start of the allocation. The headroom offsets data
+	///		from the start of the allocation, so vector_calloc_aligned alignment does not hold for deques.
+	bool_t vector_setdeque(vector* vector, bool_t enable) {
+		if (vector->flags & VECTOR_FLAG_MAPPED)
 			return false;
 
-		memmove((int08_t*)vector->data + (byteIndex + vector->typeSize), (int08_t*)vector->data + byteIndex, vector->iterator - byteIndex);
-		memcpy((int08_t*)vector->data + byteIndex, data, vector->typeSize);
-		vector->iterator += vector->typeSize;
+		if (enable) {
+			vector->flags |= VECTOR_FLAG_DEQUE;
+			return true;
+		}
+
+		if (vector->front > 0) {
+			if (!VECTOR_WRITABLE(vector))
+				return false;
+			vector_drop_front(vector);
+		}
+		vector->flags &= ~VECTOR_FLAG_DEQUE;
 		return true;
 	}
 
-	/// Returns TRUE if the item replaces an existing item in the vector, else FALSE.
-	bool_t vector_replace(vector* vector, void_t* data, size_t index) {
-		size_t byteIndex = index * vector->typeSize;
-
-		if (&vector->data == NULL || byteIndex < 0 || byteIndex >= vector->iterator)
-			return false;
+	/// Returns TRUE if the vector can hold at least [length] items (growing by its policy if needed), else FALSE.
+	bool_t vector_grow(vector* vector, size_t length) {
+		size_t capacity = vector->length / vector->typeSize;
+		if (length <= capacity && vector->data != NULL)
+			return true;
+		if (vector->flags & VECTOR_FLAG_DEQUE)
+			return vector_deque_recenter(vector, length);
 
-		memcpy((int08_t*)vector->data + byteIndex, data, vector->typeSize);
-		return true;
+		size_t grown = ((vector->growth != NULL)? vector->growth : vector_grow_double)(capacity, length);
+		return vector_realloc(vector, VECTOR_MAX(grown, length)) || (grown > length && vector_realloc(vector, length));
 	}
 
-	/// Returns TRUE if the item replaces an existing item in the vector, else FALSE.
-	bool_t vector_replace_unsafe(vector* vector, void_t* data, size_t index, size_t byteCount) {
-		size_t byteIndex = index * vector->typeSize;
-
-		if (&vector->data == NULL || byteIndex < 0 || byteIndex >= vector->iterator)
-			return false;
+	/// Returns TRUE if the vector can hold at least [length] items (never shrinks), else FALSE.
+	bool_t vector_reserve(vector* vector, size_t length) {
+		if (length * vector->typeSize <= vector->length && vector->data != NULL)
+			return true;
 
-		memmove((int08_t*)vector->data + byteIndex, data, byteCount);
-		return true;
+		return vector_realloc(vector, length);
 	}
 
-	/// Returns TRUE if the element at [index] can be removed, else FALSE.
-	bool_t vector_remove(vector* vector, size_t index) {
-		size_t byteIndex = index * vector->typeSize;
-		if (vector->data == NULL || byteIndex < 0 || byteIndex > vector->iterator)
+	/// Returns TRUE if the vector memory was shrunk to its item count (free'd if empty), else FALSE.
+	bool_t vector_shrink_to_fit(vector* vector) {
+		if (vector->data == NULL)
 			return false;
 
-		vector->iterator -= (vector->iterator > 0)? vector->typeSize : 0;
-		memmove((int08_t*)vector->data + byteIndex, (int08_t*)vector->data + byteIndex + vector->typeSize, vector->iterator - byteIndex);
-		return true;
-	}
+		if (vector->flags & (VECTOR_FLAG_INLINE | VECTOR_FLAG_MAPPED))
+			return (vector->flags & VECTOR_FLAG_INLINE) || vector->iterator == 0 || vector_realloc(vector, vector->iterator / vector->typeSize);
 
-	typedef _CoreCrtNonSecureSearchSortCompareFunction qsort_callback;
-	/// Uses qsort from <stdlib.h> to sort the items in a vector.
-	void_t vector_qsort(vector* vector, qsort_callback sorter) {
-		qsort(vector->data, (vector->iterator / vector->typeSize), vector->typeSize, sorter);
+		if (vector->iterator == 0)
+			return vector_free(vector);
+
+		if (vector->front > 0) {
+			if (!VECTOR_WRITABLE(vector))
+				return false;
+			vector_drop_front(vector);
+		}
+		return vector_realloc(vector, vector->iterator / vector->typeSize);
 	}
 
-	/// Returns NULL if index is not within bounds iterator > index >= 0 or returns pointer to element in vector.
-	void_t* vector_get(vector* vector, size_t index) {
-		size_t byteIndex = index * vector->typeSize;
-		if (&vector->data == NULL || byteIndex < 0 || byteIndex > vector->iterator)
+	/// Returns the buffer of a vector (first element at the start of the allocation) and resets the vector to empty:
+	///		the caller owns the buffer and releases it with free() (or the vector's allocator) and [outCount] (if not NULL)
+	///		receives the item count. O(1) unless the buffer is shared (copied), inline (copied to the heap) or has deque
+	///		headroom (elements moved to the front of the allocation). Returns NULL for unallocated or file-backed vectors.
+	void_t* vector_detach(vector* vector, size_t* outCount) {
+		if (outCount != NULL)
+			(*outCount) = 0;
+		if (vector->data == NULL || (vector->flags & VECTOR_FLAG_MAPPED) || !VECTOR_WRITABLE(vector))
 			return NULL;
 
-		return (int08_t*)vector->data + byteIndex;
-	}
-
-	/// Returns a pointer to a new string constructed from a vector: outLen can be pointer to get length, or NULL to ignore.
-	char_t* vector_makestr(vector* vector, size_t first, size_t last, size_t* outLen) {
-		if (outLen != NULL) {
-			(*outLen) = VECTOR_MIN(0, VECTOR_MAX(last - first, last));
-			char_t* string = (char_t*) calloc((*outLen) + 1, sizeof(char_t));
-			memmove(string, vector->data, (*outLen));
-			return string;
+		void_t* data = vector->data;
+		if (vector->flags & VECTOR_FLAG_INLINE) {
+			data = vector_mem_realloc(vector->allocator, NULL, 0, VECTOR_MAX(vector->iterator, (size_t)vector->typeSize));
+			if (data == NULL)
+				return NULL;
+			memcpy(data, vector->data, vector->iterator);
 		} else {
-			size_t length = VECTOR_MIN(0, VECTOR_MAX(last - first, last));
-			char_t* string = (char_t*) calloc(length + 1, sizeof(char_t));
-			memmove(string, vector->data, length);
-			return string;
+			vector_drop_front(vector);
+			data = vector->data;
 		}
+
+		if (outCount != NULL)
+			(*outCount) = vector->iterator / vector->typeSize;
+		vector->flags &= ~VECTOR_FLAG_INLINE;
+		vector->data = NULL;
+		vector->length = vector->iterator = vector->front = 0;
+		return data;
 	}
 
-	/// Returns a pointer to a new string that is a copy of the input string.
-	char_t* vector_cpystr(const char_t* str) {
-		size_t length = strlen(str);
-		char_t* string = (char_t*) calloc(length + 1, sizeof(char_t));
-		memmove(string, str, length);
-		return string;
+	/// Returns a vector that takes ownership of [data] holding [count] items with room for [capacity] items of [typeSize] bytes
+	///		in O(1): [data] must come from malloc/calloc/realloc (it is released by vector_free) and capacity >= count.
+	vector vector_adopt(void_t* data, size_t count, size_t capacity, int32_t typeSize) {
+		VECTOR_ASSERT(count <= capacity);
+		if (data == NULL)
+			return vector_calloc3(typeSize, 0, false, NULL);
+		return (vector) { .typeSize = typeSize, .length = capacity * (size_t)typeSize, .iterator = count * (size_t)typeSize, .data = data };
 	}
 
+	/// Exchanges the contents (buffer, count, capacity, policy and allocator) of two vectors in O(1).
+	void_t vector_swap(vector* a, vector* b) {
+		vector swap = *a;
+		*a = *b;
+		*b = swap;
+	}
+
+	/// Returns TRUE if [dest] now holds a copy of the elements of [source] (replacing its own), else FALSE if the type sizes
+	///		differ (an unallocated [dest] takes the type size of [source]) or allocation failed. Copies of at least
+	///		VECTOR_STREAM_THRESHOLD bytes use non-temporal stores, so cloning a huge vector does not flush the cache.
+	bool_t vector_copy(vector* dest, vector* source) {
+		if (dest == source)
+			return true;
+		if (dest->typeSize != source->typeSize) {
+			if (dest->data != NULL)
+				return false;
+			dest->typeSize = source->typeSize;
+		}
+
+		size_t count = source->iterator / source->typeSize;
+		if (dest->data != NULL && !VECTOR_WRITABLE(dest))
+			return false;
+		dest->iterator = 0;
+		if (count == 0)
+			return true;
+		if (!vector_reserve(dest, count))
+			return false;
+
+		vector_copy_bytes(dest->data, source->data, source->iterator);
+		dest->iterator = source->iterator;
+		return true;
+	}
+
+	/// Returns TRUE if the vector is allocated, else FALSE.
+	bool_t vector_isalloc(vector* vector) {
+		return vector->data != NULL;
+	}
+
+	/// Returns the full byte-length of allocated memory for a vector.
+	size_t vector_bytesize(vector* vector) {
+		return vector->length;
+	}
+
+	/// Returns the maximum number of elements that can be written (until resized on insert).
+	size_t vector_maxsize(vector* vector) {
+		return vector->length / vector->typeSize;
+	}
+
+	/// Returns the alignment the data of a vector keeps across growth (vector_calloc_aligned), else the alignment of the
+	///		current data pointer (which may change when the vector grows), or 0 if the vector is not allocated.
+	size_t vector_alignment(vector* vector) {
+		if (vector->data == NULL)
+			return 0;
+		if (vector->front == 0 && vector->allocator >= vector_aligned_allocators && vector->allocator < vector_aligned_allocators + VECTOR_ALIGNMENTS)
+			return *(const size_t*) vector->allocator->context;
+		uintptr_t address = (uintptr_t) vector->data;
+		return (size_t)(address & (~address + 1));
+	}
+
+	/// Returns the byte-size of the type used for allocations within a vector.
+	size_t vector_typesize(vector* vector) {
+		return vector->typeSize;
+	}
+
+	/// Returns the item length of a vector.
+	size_t vector_length(vector* vector) {
+		return (vector->length / vector->typeSize);
+	}
+
+	/// Returns the item count (same-as last iterator position) of a vector.
+	size_t vector_count(vector* vector) {
+		return (vector->iterator / vector->typeSize);
+	}
+
+	#ifdef VECTOR_STATS
+		/// Sets the hook called after every capacity change of any vector (NULL to remove): install before vectors are shared across threads.
+		void_t vector_stats_listen(vector_stats_callback callback, void_t* context) {
+			vector_stats_hook = callback;
+			vector_stats_context = context;
+		}
+
+		/// Returns the counters of a vector (peakLength includes its current capacity).
+		vector_stats vector_stats_get(vector* vector) {
+			vector_stats stats = vector->stats;
+			stats.peakLength = VECTOR_MAX(stats.peakLength, vector->length);
+			stats.peakCount = VECTOR_MAX(stats.peakCount, vector_count(vector));
+			return stats;
+		}
+
+		/// Resets the counters of a vector.
+		void_t vector_stats_reset(vector* vector) {
+			memset(&vector->stats, 0, sizeof(vector_stats));
+		}
+
+		/// Returns the allocated bytes not holding elements (length - iterator).
+		size_t vector_stats_wasted(vector* vector) {
+			return vector->length - vector->iterator;
+		}
+
+		/// Writes one line of counters for a vector labelled [name] to [out] (NULL for stderr).
+		void_t vector_stats_dump(vector* vector, const char_t* name, FILE* out) {
+			vector_stats stats = vector_stats_get(vector);
+			fprintf((out != NULL)? out : stderr, "%s: count=%zu capacity=%zu peak_count=%zu peak_bytes=%zu wasted_bytes=%zu reallocs=%zu moved_bytes=%zu\n",
+				(name != NULL)? name : "vector", vector_count(vector), vector_maxsize(vector), stats.peakCount, stats.peakLength,
+				vector_stats_wasted(vector), stats.reallocs, stats.bytesMoved);
+		}
+	#endif
+
+	/// Returns FALSE if [iterator] is not within bounds length >= iterator >= 0, else TRUE and set new iterator position.
+	bool_t vector_move(vector* vector, size_t iterator) {
+		VECTOR_ASSERT(vector != NULL);
+		if ((iterator * vector->typeSize) > vector->length)
+			return false;
+
+		vector->iterator = iterator * vector->typeSize;
+		return true;
+	}
+
+	/// Fills [count] elements of [typeSize] bytes at [dest] with [data]: memset for single-byte patterns,
+	///		broadcast stores for 2/4/8-byte elements, else doubling memcpy (1, 2, 4... elements per copy).
+	void_t vector_fill_bytes(void_t* dest, const void_t* data, size_t typeSize, size_t count) {
+		const uint08_t* pattern = (const uint08_t*) data;
+		size_t bytes = typeSize * count, i = 1;
+		if (bytes == 0)
+			return;
+
+		#ifdef VECTOR_SIMD_SSE2
+			size_t head = (16 - ((uintptr_t) dest & 15)) & 15;
+			size_t period = typeSize * 16 / VECTOR_MIN(typeSize & (~typeSize + 1), 16);
+			if (bytes >= VECTOR_STREAM_THRESHOLD && period <= VECTOR_STREAM_PATTERN) {
+				// The pattern repeats every lcm(typeSize, 16) bytes: stream it from a table starting at the first aligned byte,
+				// and fill the (under 16 byte) unaligned head and tail byte by byte.
+				_Alignas(16) uint08_t table[VECTOR_STREAM_PATTERN];
+				for (size_t k = 0; k < period; k++)
+					table[k] = pattern[(head + k) % typeSize];
+
+				uint08_t* bytesOut = (uint08_t*) dest;
+				size_t blocks = (bytes - head) / 16, end = head + blocks * 16;
+				for (size_t k = 0; k < head; k++)
+					bytesOut[k] = pattern[k % typeSize];
+				for (size_t b = 0, k = 0; b < blocks; b++, k = (k + 16 < period)? k + 16 : 0)
+					_mm_stream_si128((__m128i*)(bytesOut + head + b * 16), _mm_load_si128((const __m128i*)(table + k)));
+				_mm_sfence();
+				for (size_t k = end; k < bytes; k++)
+					bytesOut[k] = pattern[k % typeSize];
+				return;
+			}
+		#endif
+
+		while (i < typeSize && pattern[i] == pattern[0]) i++;
+		if (i == typeSize) {
+			memset(dest, pattern[0], bytes);
+			return;
+		}
+
+		switch (((uintptr_t)dest % typeSize == 0)? typeSize : 0) {
+			case 2: { uint16_t v; memcpy(&v, data, 2); uint16_t* d = (uint16_t*) dest; for (i = 0; i < count; i++) d[i] = v; return; }
+			case 4: { uint32_t v; memcpy(&v, data, 4); uint32_t* d = (uint32_t*) dest; for (i = 0; i < count; i++) d[i] = v; return; }
+			case 8: { uint64_t v; memcpy(&v, data, 8); uint64_t* d = (uint64_t*) dest; for (i = 0; i < count; i++) d[i] = v; return; }
+		}
+
+		memcpy(dest, data, typeSize);
+		for (size_t filled = typeSize; filled < bytes; filled <<= 1)
+			memcpy((int08_t*)dest + filled, dest, VECTOR_MIN(filled, bytes - filled));
+	}
+
+	/// Returns TRUE if the vector can be cleared, else FALSE.
+	bool_t vector_clear(vector* vector, void_t* data) {
+		VECTOR_ASSERT(vector != NULL && data != NULL);
+		if (vector->data == NULL || vector->length == 0 || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector_fill_bytes(vector->data, data, vector->typeSize, vector->length / vector->typeSize);
+		vector->iterator = 0;
+		return true;
+	}
+
+	/// Returns TRUE if the live elements within [first, last) were set to [data] (iterator >= last >= first >= 0), else FALSE.
+	bool_t vector_fill_range(vector* vector, size_t first, size_t last, const void_t* data) {
+		VECTOR_ASSERT(vector != NULL && data != NULL && first <= last);
+		if (vector->data == NULL || first > last || last * vector->typeSize > vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector_fill_bytes((int08_t*)vector->data + first * vector->typeSize, data, vector->typeSize, last - first);
+		return true;
+	}
+
+	/// Returns TRUE if the vector is allocated and the element at [index] can be written, else FALSE.
+	bool_t vector_insert(vector* vector, void_t* data, size_t index) {
+		VECTOR_ASSERT(vector != NULL && data != NULL);
+		size_t byteIndex = index * vector->typeSize;
+
+		if (byteIndex > vector->iterator)
+			return false;
+
+		if ((vector->flags & VECTOR_FLAG_DEQUE) && byteIndex < vector->iterator - byteIndex) {
+			if (!VECTOR_WRITABLE(vector) || (vector->front < (size_t)vector->typeSize && !vector_deque_recenter(vector, vector_count(vector) + 1)))
+				return false;
+
+			vector->data = (int08_t*)vector->data - vector->typeSize;
+			vector->front -= vector->typeSize;
+			vector->length += vector->typeSize;
+			memmove(vector->data, (int08_t*)vector->data + vector->typeSize, byteIndex);
+			memcpy((int08_t*)vector->data + byteIndex, data, vector->typeSize);
+			VECTOR_STATS_MOVED(vector, byteIndex);
+			vector->iterator += vector->typeSize;
+			VECTOR_STATS_COUNT(vector);
+			return true;
+		}
+
+		if (vector->iterator == vector->length || vector->data == NULL)
+			if (!vector_grow(vector, vector_count(vector) + 1))
+				return false;
+		if (!VECTOR_WRITABLE(vector))
+			return false;
+
+		vector_move_bytes((int08_t*)vector->data + (byteIndex + vector->typeSize), (int08_t*)vector->data + byteIndex, vector->iterator - byteIndex);
+		memcpy((int08_t*)vector->data + byteIndex, data, vector->typeSize);
+		VECTOR_STATS_MOVED(vector, vector->iterator - byteIndex);
+		vector->iterator += vector->typeSize;
+		VECTOR_STATS_COUNT(vector);
+		return true;
+	}
+
+	/// Returns TRUE if the item replaces an existing item in the vector, else FALSE.
+	bool_t vector_replace(vector* vector, void_t* data, size_t index) {
+		VECTOR_ASSERT(vector != NULL && data != NULL);
+		size_t byteIndex = index * vector->typeSize;
+
+		if (vector->data == NULL || byteIndex >= vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		memcpy((int08_t*)vector->data + byteIndex, data, vector->typeSize);
+		return true;
+	}
+
+	/// Returns TRUE if the item replaces an existing item in the vector, else FALSE.
+	bool_t vector_replace_unsafe(vector* vector, void_t* data, size_t index, size_t byteCount) {
+		VECTOR_ASSERT(vector != NULL && data != NULL);
+		size_t byteIndex = index * vector->typeSize;
+
+		if (vector->data == NULL || byteIndex >= vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		memmove((int08_t*)vector->data + byteIndex, data, byteCount);
+		return true;
+	}
+
+	/// Returns TRUE if the element at [index] can be removed, else FALSE.
+	bool_t vector_remove(vector* vector, size_t index) {
+		VECTOR_ASSERT(vector != NULL);
+		size_t byteIndex = index * vector->typeSize;
+		if (vector->data == NULL || byteIndex >= vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector->iterator -= vector->typeSize;
+		if ((vector->flags & VECTOR_FLAG_DEQUE) && byteIndex < vector->iterator - byteIndex) {
+			memmove((int08_t*)vector->data + vector->typeSize, vector->data, byteIndex);
+			VECTOR_STATS_MOVED(vector, byteIndex);
+			vector->data = (int08_t*)vector->data + vector->typeSize;
+			vector->front += vector->typeSize;
+			vector->length -= vector->typeSize;
+			return true;
+		}
+
+		vector_move_bytes((int08_t*)vector->data + byteIndex, (int08_t*)vector->data + byteIndex + vector->typeSize, vector->iterator - byteIndex);
+		VECTOR_STATS_MOVED(vector, vector->iterator - byteIndex);
+		return true;
+	}
+
+	/// Returns TRUE if [data] was inserted before the first element (amortized O(1) in deque mode), else FALSE.
+	bool_t vector_push_front(vector* vector, void_t* data) {
+		return vector_insert(vector, data, 0);
+	}
+
+	/// Returns TRUE if the first element was removed (copied to [data] if not NULL, amortized O(1) in deque mode), else FALSE.
+	bool_t vector_pop_front(vector* vector, void_t* data) {
+		if (vector->data == NULL || vector->iterator == 0)
+			return false;
+		if (data != NULL)
+			memcpy(data, vector->data, vector->typeSize);
+		return vector_remove(vector, 0);
+	}
+
+	/// Returns TRUE if [count] elements from [data] are written starting at [index] (iterator >= index >= 0), else FALSE.
+	///		Grows the vector at most once and shifts the tail with a single memmove. [data] must not point into the vector.
+	bool_t vector_insert_range(vector* vector, const void_t* data, size_t count, size_t index) {
+		VECTOR_ASSERT(vector != NULL && (data != NULL || count == 0));
+		size_t byteIndex = index * vector->typeSize;
+		size_t byteCount = count * vector->typeSize;
+
+		if (byteIndex > vector->iterator)
+			return false;
+		if (byteCount == 0)
+			return true;
+
+		if (vector->iterator + byteCount > vector->length || vector->data == NULL)
+			if (!vector_grow(vector, vector_count(vector) + count))
+				return false;
+		if (!VECTOR_WRITABLE(vector))
+			return false;
+
+		vector_move_bytes((int08_t*)vector->data + (byteIndex + byteCount), (int08_t*)vector->data + byteIndex, vector->iterator - byteIndex);
+		vector_copy_bytes((int08_t*)vector->data + byteIndex, data, byteCount);
+		VECTOR_STATS_MOVED(vector, vector->iterator - byteIndex);
+		vector->iterator += byteCount;
+		VECTOR_STATS_COUNT(vector);
+		return true;
+	}
+
+	/// Returns TRUE if [count] elements from [data] are written to the end of the vector, else FALSE.
+	bool_t vector_append_range(vector* vector, const void_t* data, size_t count) {
+		return vector_insert_range(vector, data, count, vector_count(vector));
+	}
+
+	/// Returns TRUE if the vector now holds [count] items (growing by its policy if needed), else FALSE.
+	///		Items past the old count are left uninitialized for the caller to write in place, e.g. with fread or recv into
+	///		vector_get(vector, oldCount); shrinking drops the items past [count].
+	bool_t vector_resize_uninit(vector* vector, size_t count) {
+		if ((count > 0 && !vector_grow(vector, count)) || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector->iterator = count * vector->typeSize;
+		VECTOR_STATS_COUNT(vector);
+		return true;
+	}
+
+	/// Returns TRUE if the elements within [first, last) can be removed (iterator >= last >= first >= 0), else FALSE.
+	///		Shifts the tail with a single memmove.
+	bool_t vector_remove_range(vector* vector, size_t first, size_t last) {
+		VECTOR_ASSERT(vector != NULL && first <= last);
+		size_t byteFirst = first * vector->typeSize;
+		size_t byteLast = last * vector->typeSize;
+
+		if (vector->data == NULL || byteFirst > byteLast || byteLast > vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector_move_bytes((int08_t*)vector->data + byteFirst, (int08_t*)vector->data + byteLast, vector->iterator - byteLast);
+		VECTOR_STATS_MOVED(vector, vector->iterator - byteLast);
+		vector->iterator -= byteLast - byteFirst;
+		return true;
+	}
+
+	/// Returns TRUE if the element at [index] can be removed by moving the last element into its place (order is not kept), else FALSE.
+	bool_t vector_remove_swap(vector* vector, size_t index) {
+		VECTOR_ASSERT(vector != NULL);
+		size_t byteIndex = index * vector->typeSize;
+		if (vector->data == NULL || byteIndex >= vector->iterator || !VECTOR_WRITABLE(vector))
+			return false;
+
+		vector->iterator -= vector->typeSize;
+		if (byteIndex != vector->iterator) {
+			memcpy((int08_t*)vector->data + byteIndex, (int08_t*)vector->data + vector->iterator, vector->typeSize);
+			VECTOR_STATS_MOVED(vector, vector->typeSize);
+		}
+		return true;
+	}
+
+	/// Predicate: returns TRUE if [item] matches, [context] is passed through from the caller.
+	typedef bool_t (*vector_predicate)(const void_t* item, void_t* context);
+
+	/// Removes every element for which [predicate] returns TRUE in one linear pass (order is kept): returns the number of elements removed.
+	size_t vector_remove_if(vector* vector, vector_predicate predicate, void_t* context) {
+		VECTOR_ASSERT(vector != NULL && predicate != NULL);
+		if (vector->data == NULL || !VECTOR_WRITABLE(vector))
+			return 0;
+
+		int08_t* data = (int08_t*)vector->data;
+		size_t write = 0, read = 0;
+		while (read < vector->iterator) {
+			size_t run = read;
+			while (run < vector->iterator && !predicate(data + run, context))
+				run += vector->typeSize;
+
+			if (write != read) {
+				memmove(data + write, data + read, run - read);
+				VECTOR_STATS_MOVED(vector, run - read);
+			}
+			write += run - read;
+			read = run + vector->typeSize; // Skip the matched element at [run].
+		}
+
+		size_t removed = (vector->iterator - write) / vector->typeSize;
+		vector->iterator = write;
+		return removed;
+	}
+
+	/// Comparator: returns <0, 0 or >0 if [a] orders before, equal to or after [b].
+	typedef int (*qsort_callback)(const void_t* a, const void_t* b);
+	/// Uses qsort from <stdlib.h> to sort the items in a vector.
+	void_t vector_qsort(vector* vector, qsort_callback sorter) {
+		if (vector->data != NULL && VECTOR_WRITABLE(vector))
+			qsort(vector->data, (vector->iterator / vector->typeSize), vector->typeSize, sorter);
+	}
+
+	/// Radix sort key types: the key is read from [offset] bytes into every element.
+	typedef enum vector_key {
+		VECTOR_KEY_U8, VECTOR_KEY_U16, VECTOR_KEY_U32, VECTOR_KEY_U64,
+		VECTOR_KEY_I8, VECTOR_KEY_I16, VECTOR_KEY_I32, VECTOR_KEY_I64,
+		VECTOR_KEY_F32, VECTOR_KEY_F64
+	} vector_key;
+
+	/// Returns the byte-size of a radix sort key type.
+	size_t vector_key_size(vector_key key) {
+		static const uint08_t sizes[] = { 1, 2, 4, 8, 1, 2, 4, 8, 4, 8 };
+		return sizes[key];
+	}
+
+	/// Returns the key at [item] mapped to an unsigned integer with the same ordering.
+	uint64_t vector_key_bits(const void_t* item, vector_key key) {
+		size_t size = vector_key_size(key);
+		uint64_t bits = 0, sign = (uint64_t)1 << (size * 8 - 1);
+		uint08_t bytes[8];
+		memcpy(bytes, item, size);
+		switch (size) {
+			case 1: bits = bytes[0]; break;
+			case 2: { uint16_t v; memcpy(&v, bytes, 2); bits = v; } break;
+			case 4: { uint32_t v; memcpy(&v, bytes, 4); bits = v; } break;
+			case 8: memcpy(&bits, bytes, 8); break;
+		}
+
+		if (key >= VECTOR_KEY_F32)
+			return (bits & sign)? ~bits & (sign | (sign - 1)) : bits | sign;
+		if (key >= VECTOR_KEY_I8)
+			return bits ^ sign;
+		return bits;
+	}
+
+	/// Returns TRUE if the vector was stably sorted by an LSD radix sort on the integer/float key at [offset] bytes into each element, else FALSE.
+	///		Uses one scratch buffer the size of the vector (from the vector's allocator) and skips digit passes where every key matches.
+	bool_t vector_radix_sort(vector* vector, vector_key key, size_t offset) {
+		size_t count = vector_count(vector), size = vector_key_size(key), typeSize = vector->typeSize;
+		if (offset + size > typeSize)
+			return false;
+		if (count < 2)
+			return true;
+		if (!VECTOR_WRITABLE(vector))
+			return false;
+
+		int08_t* scratch = (int08_t*) vector_mem_realloc(vector->allocator, NULL, 0, vector->iterator);
+		if (scratch == NULL)
+			return false;
+
+		size_t histogram[8][256];
+		memset(histogram, 0, sizeof(histogram[0]) * size);
+		for (size_t i = 0; i < count; i++) {
+			uint64_t bits = vector_key_bits((int08_t*)vector->data + i * typeSize + offset, key);
+			for (size_t pass = 0; pass < size; pass++)
+				histogram[pass][(bits >> (pass * 8)) & 0xFF]++;
+		}
+
+		int08_t* source = (int08_t*) vector->data, *dest = scratch;
+		for (size_t pass = 0; pass < size; pass++) {
+			size_t* buckets = histogram[pass];
+			uint64_t first = vector_key_bits(source + offset, key);
+			if (buckets[(first >> (pass * 8)) & 0xFF] == count)
+				continue;
+
+			for (size_t digit = 0, sum = 0; digit < 256; digit++) {
+				size_t bucket = buckets[digit];
+				buckets[digit] = sum;
+				sum += bucket;
+			}
+
+			for (size_t i = 0; i < count; i++) {
+				int08_t* item = source + i * typeSize;
+				size_t digit = (vector_key_bits(item + offset, key) >> (pass * 8)) & 0xFF;
+				memcpy(dest + (buckets[digit]++) * typeSize, item, typeSize);
+			}
+
+			int08_t* swap = source;
+			source = dest;
+			dest = swap;
+		}
+
+		if (source != (int08_t*) vector->data)
+			memcpy(vector->data, source, vector->iterator);
+
+		vector_mem_free(vector->allocator, scratch, vector->iterator);
+		return true;
+	}
+
+	/// Merge sort task: sorts [first, last) of source in place, or merges [first, middle) and [middle, last) from source into dest.
+	typedef struct vector_psort_task {
+		int08_t* source;
+		int08_t* dest;
+		size_t first, middle, last;
+		size_t typeSize;
+		qsort_callback sorter;
+	} vector_psort_task;
+
+	void_t vector_psort_chunk(void_t* task) {
+		vector_psort_task* sort = (vector_psort_task*) task;
+		qsort(sort->source + sort->first * sort->typeSize, sort->last - sort->first, sort->typeSize, sort->sorter);
+	}
+
+	void_t vector_psort_merge(void_t* task) {
+		vector_psort_task* sort = (vector_psort_task*) task;
+		size_t typeSize = sort->typeSize;
+		int08_t* left = sort->source + sort->first * typeSize, *leftEnd = sort->source + sort->middle * typeSize;
+		int08_t* right = leftEnd, *rightEnd = sort->source + sort->last * typeSize;
+		int08_t* dest = sort->dest + sort->first * typeSize;
+
+		while (left < leftEnd && right < rightEnd) {
+			if (sort->sorter(right, left) < 0) {
+				memcpy(dest, right, typeSize);
+				right += typeSize;
+			} else {
+				memcpy(dest, left, typeSize);
+				left += typeSize;
+			}
+			dest += typeSize;
+		}
+
+		memcpy(dest, left, leftEnd - left);
+		memcpy(dest + (leftEnd - left), right, rightEnd - right);
+	}
+
+	/// Returns TRUE if the vector was sorted by a multi-threaded merge sort over [threads] threads (0 for every hardware thread), else FALSE.
+	///		Each thread qsorts one chunk, then chunks are merged pairwise in parallel. Runs on the calling thread without VECTOR_THREADS.
+	bool_t vector_psort(vector* vector, qsort_callback sorter, size_t threads) {
+		size_t count = vector_count(vector);
+		threads = VECTOR_MIN((threads > 0)? threads : vector_thread_count(), VECTOR_MAX(count / 4096, 1));
+		if (!VECTOR_WRITABLE(vector))
+			return false;
+		if (threads <= 1) {
+			vector_qsort(vector, sorter);
+			return true;
+		}
+
+		vector_psort_task* tasks = (vector_psort_task*) malloc(threads * sizeof(vector_psort_task));
+		int08_t* scratch = (int08_t*) vector_mem_realloc(vector->allocator, NULL, 0, vector->iterator);
+		if (tasks == NULL || scratch == NULL) {
+			free(tasks);
+			vector_mem_free(vector->allocator, scratch, vector->iterator);
+			return false;
+		}
+
+		int08_t* source = (int08_t*) vector->data, *dest = scratch;
+		for (size_t i = 0; i < threads; i++)
+			tasks[i] = (vector_psort_task) { source, dest, count * i / threads, 0, count * (i + 1) / threads, vector->typeSize, sorter };
+		vector_thread_run(vector_psort_chunk, tasks, sizeof(vector_psort_task), threads);
+
+		for (size_t runs = threads; runs > 1; runs = (runs + 1) >> 1) {
+			size_t merges = runs >> 1;
+			for (size_t i = 0; i < merges; i++)
+				tasks[i] = (vector_psort_task) { source, dest, tasks[2 * i].first, tasks[2 * i].last, tasks[2 * i + 1].last, vector->typeSize, sorter };
+
+			if (runs & 1) {
+				vector_psort_task odd = tasks[runs - 1];
+				memcpy(dest + odd.first * odd.typeSize, source + odd.first * odd.typeSize, (odd.last - odd.first) * odd.typeSize);
+				tasks[merges] = (vector_psort_task) { source, dest, odd.first, odd.last, odd.last, vector->typeSize, sorter };
+			}
+
+			vector_thread_run(vector_psort_merge, tasks, sizeof(vector_psort_task), merges);
+
+			int08_t* swap = source;
+			source = dest;
+			dest = swap;
+		}
+
+		if (source != (int08_t*) vector->data)
+			memcpy(vector->data, source, vector->iterator);
+
+		vector_mem_free(vector->allocator, scratch, vector->iterator);
+		free(tasks);
+		return true;
+	}
+
+	/// Returns the index of the first element of a sorted vector that does not order before [key] (vector_count if none).
+	size_t vector_lower_bound(vector* vector, const void_t* key, qsort_callback sorter) {
+		size_t first = 0, count = vector_count(vector);
+		while (count > 0) {
+			size_t half = count >> 1;
+			if (sorter((int08_t*)vector->data + (first + half) * vector->typeSize, key) < 0) {
+				first += half + 1;
+				count -= half + 1;
+			} else count = half;
+		}
+		return first;
+	}
+
+	/// Returns the index of the first element of a sorted vector that orders after [key] (vector_count if none).
+	size_t vector_upper_bound(vector* vector, const void_t* key, qsort_callback sorter) {
+		size_t first = 0, count = vector_count(vector);
+		while (count > 0) {
+			size_t half = count >> 1;
+			if (sorter(key, (int08_t*)vector->data + (first + half) * vector->typeSize) >= 0) {
+				first += half + 1;
+				count -= half + 1;
+			} else count = half;
+		}
+		return first;
+	}
+
+	/// Returns a pointer to the first element of a sorted vector equal to [key], or NULL if not found.
+	void_t* vector_bsearch(vector* vector, const void_t* key, qsort_callback sorter) {
+		size_t index = vector_lower_bound(vector, key, sorter);
+		if (index >= vector_count(vector))
+			return NULL;
+
+		void_t* item = (int08_t*)vector->data + index * vector->typeSize;
+		return (sorter(item, key) == 0)? item : NULL;
+	}
+
+	/// Returns TRUE if [data] was inserted after any equal elements of a sorted vector (keeping it sorted), else FALSE.
+	bool_t vector_insert_sorted(vector* vector, void_t* data, qsort_callback sorter) {
+		return vector_insert(vector, data, vector_upper_bound(vector, data, sorter));
+	}
+
+	/// Returns the number of trailing zero bits of [bits] (64 if zero).
+	size_t vector_ctz(uint64_t bits) {
+		if (bits == 0)
+			return 64;
+		#if defined(__GNUC__) || defined(__clang__)
+			return (size_t)__builtin_ctzll(bits);
+		#else
+			size_t count = 0;
+			for (; !(bits & 1); bits >>= 1) count++;
+			return count;
+		#endif
+	}
+
+	/// Returns the index of the highest set bit of [bits] (0 if zero).
+	size_t vector_msb(uint64_t bits) {
+		#if defined(__GNUC__) || defined(__clang__)
+			return (bits != 0)? 63 - (size_t)__builtin_clzll(bits) : 0;
+		#else
+			size_t index = 0;
+			while (bits >>= 1) index++;
+			return index;
+		#endif
+	}
+
+	/// Returns the number of set bits of [bits].
+	size_t vector_popcount(uint64_t bits) {
+		#if defined(__GNUC__) || defined(__clang__)
+			return (size_t)__builtin_popcountll(bits);
+		#else
+			size_t count = 0;
+			for (; bits != 0; bits &= bits - 1) count++;
+			return count;
+		#endif
+	}
+
+	/// 
+	/// SIMD Search
+	///		vector_find/count_eq/contains compare elements bitwise (like memcmp, so
+	///		-0.0f != 0.0f and identical NaNs match). For 1, 2, 4 and 8 byte types
+	///		the key is broadcast into a register and whole blocks are compared with
+	///		one byte-wise equality: an element matches when all of its bytes do.
+	///		Kernels: AVX2 (picked at runtime on GCC/Clang), SSE2 (x86-64 baseline)
+	///		and NEON (AArch64). Other type sizes, or VECTOR_NO_SIMD, use memcmp.
+	/// 
+	/// Reduces a byte-equality [mask] ([step] bits per byte) to one set bit per matching element of [width] bytes.
+	static inline uint64_t vector_mask_elements(uint64_t mask, size_t width, size_t step) {
+		static const uint64_t keep[6] = { ~0ull, 0x5555555555555555ull, 0x1111111111111111ull,
+			0x0101010101010101ull, 0x0001000100010001ull, 0x0000000100000001ull };
+		for (size_t shift = step; shift < width * step; shift <<= 1)
+			mask &= mask >> shift;
+		return mask & keep[vector_ctz(width * step)];
+	}
+
+	#ifdef VECTOR_SIMD_SSE2
+		/// Scans [blocks] 16-byte blocks against [pattern]: returns the index of the first match if [first] (elements scanned if none), else the match count.
+		size_t vector_scan_sse2(const uint08_t* data, size_t blocks, size_t width, const uint08_t* pattern, bool_t first) {
+			__m128i key = _mm_loadu_si128((const __m128i*) pattern);
+			size_t matches = 0;
+			for (size_t b = 0; b < blocks; b++) {
+				__m128i items = _mm_loadu_si128((const __m128i*)(data + b * 16));
+				uint64_t mask = vector_mask_elements((uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(items, key)), width, 1);
+				if (first && mask != 0)
+					return (b * 16 + vector_ctz(mask)) / width;
+				matches += vector_popcount(mask);
+			}
+			return first? (blocks * 16) / width : matches;
+		}
+	#endif
+
+	#ifdef VECTOR_SIMD_AVX2
+		/// Scans [blocks] 32-byte blocks against [pattern]: returns the index of the first match if [first] (elements scanned if none), else the match count.
+		__attribute__((target("avx2")))
+		size_t vector_scan_avx2(const uint08_t* data, size_t blocks, size_t width, const uint08_t* pattern, bool_t first) {
+			__m256i key = _mm256_loadu_si256((const __m256i*) pattern);
+			size_t matches = 0;
+			for (size_t b = 0; b < blocks; b++) {
+				__m256i items = _mm256_loadu_si256((const __m256i*)(data + b * 32));
+				uint64_t mask = vector_mask_elements((uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(items, key)), width, 1);
+				if (first && mask != 0)
+					return (b * 32 + vector_ctz(mask)) / width;
+				matches += vector_popcount(mask);
+			}
+			return first? (blocks * 32) / width : matches;
+		}
+	#endif
+
+	#ifdef VECTOR_SIMD_NEON
+		/// Scans [blocks] 16-byte blocks against [pattern]: returns the index of the first match if [first] (elements scanned if none), else the match count.
+		size_t vector_scan_neon(const uint08_t* data, size_t blocks, size_t width, const uint08_t* pattern, bool_t first) {
+			uint8x16_t key = vld1q_u8(pattern);
+			size_t matches = 0;
+			for (size_t b = 0; b < blocks; b++) {
+				uint8x16_t equal = vceqq_u8(vld1q_u8(data + b * 16), key);
+				uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+				uint64_t mask = vector_mask_elements(nibbles, width, 4);
+				if (first && mask != 0)
+					return (b * 16 + vector_ctz(mask) / 4) / width;
+				matches += vector_popcount(mask);
+			}
+			return first? (blocks * 16) / width : matches;
+		}
+	#endif
+
+	/// Returns the index of the first element equal to [key] if [first] (vector_count if none), else the number of equal elements.
+	size_t vector_scan(vector* vector, const void_t* key, bool_t first) {
+		VECTOR_ASSERT(vector != NULL);
+		size_t width = (size_t) vector->typeSize, count = vector_count(vector), index = 0, matches = 0;
+		const uint08_t* data = (const uint08_t*) vector->data;
+		if (data == NULL || count == 0)
+			return 0;
+
+		#if defined(VECTOR_SIMD_SSE2) || defined(VECTOR_SIMD_NEON)
+			if (width == 1 || width == 2 || width == 4 || width == 8) {
+				uint08_t pattern[32];
+				for (size_t i = 0; i < sizeof(pattern); i += width)
+					memcpy(pattern + i, key, width);
+
+				size_t block = 16;
+				size_t (*scan)(const uint08_t*, size_t, size_t, const uint08_t*, bool_t);
+				#if defined(VECTOR_SIMD_NEON)
+					scan = vector_scan_neon;
+				#else
+					scan = vector_scan_sse2;
+					#ifdef VECTOR_SIMD_AVX2
+						if (__builtin_cpu_supports("avx2")) {
+							scan = vector_scan_avx2;
+							block = 32;
+						}
+					#endif
+				#endif
+
+				size_t blocks = (count * width) / block;
+				size_t result = scan(data, blocks, width, pattern, first);
+				index = (blocks * block) / width;
+				if (first && result < index)
+					return result;
+				if (!first)
+					matches = result;
+			}
+		#endif
+
+		for (; index < count; index++)
+			if (memcmp(data + index * width, key, width) == 0) {
+				if (first)
+					return index;
+				matches++;
+			}
+		return first? count : matches;
+	}
+
+	/// Returns the index of the first element bitwise equal to [key], or vector_count if not found.
+	size_t vector_find(vector* vector, const void_t* key) {
+		return vector_scan(vector, key, true);
+	}
+
+	/// Returns the number of elements bitwise equal to [key].
+	size_t vector_count_eq(vector* vector, const void_t* key) {
+		return vector_scan(vector, key, false);
+	}
+
+	/// Returns TRUE if any element is bitwise equal to [key], else FALSE.
+	bool_t vector_contains(vector* vector, const void_t* key) {
+		return vector_scan(vector, key, true) < vector_count(vector);
+	}
+
+	/// Returns a mask with bit i set if element i of the 16-byte blocks [a] and [b] is bitwise equal (16 / [width] elements).
+	static inline uint64_t vector_equal_block(const uint08_t* a, const uint08_t* b, size_t width) {
+		#if defined(VECTOR_SIMD_SSE2)
+			__m128i x = _mm_loadu_si128((const __m128i*) a), y = _mm_loadu_si128((const __m128i*) b);
+			switch (width) {
+				case 1: return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+				case 2: return (uint32_t) _mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(x, y), _mm_setzero_si128()));
+				case 4: return (uint32_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, y)));
+				default: {
+					__m128i equal = _mm_cmpeq_epi32(x, y);
+					equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+					return (uint32_t) _mm_movemask_pd(_mm_castsi128_pd(equal));
+				}
+			}
+		#elif defined(VECTOR_SIMD_NEON)
+			uint8x16_t equal = vceqq_u8(vld1q_u8(a), vld1q_u8(b));
+			uint64_t nibbles = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+			uint64_t spread = vector_mask_elements(nibbles, width, 4), mask = 0;
+			for (; spread != 0; spread &= spread - 1)
+				mask |= 1ull << (vector_ctz(spread) / (4 * width));
+			return mask;
+		#else
+			uint64_t mask = 0;
+			for (size_t i = 0; i < 16 / width; i++)
+				mask |= (uint64_t)(memcmp(a + i * width, b + i * width, width) == 0) << i;
+			return mask;
+		#endif
+	}
+
+	/// Equality: returns TRUE if [a] and [b] are equal.
+	typedef bool_t (*vector_equal_func)(const void_t* a, const void_t* b);
+
+	/// Stable compaction state: kept runs are merged and moved down to [write] with one memmove per run.
+	typedef struct vector_compactor {
+		int08_t* data;
+		size_t typeSize, write, first, last;
+	} vector_compactor;
+
+	static inline void_t vector_compact_flush(vector_compactor* compactor) {
+		size_t bytes = (compactor->last - compactor->first) * compactor->typeSize;
+		if (compactor->write != compactor->first && bytes > 0)
+			vector_move_bytes(compactor->data + compactor->write * compactor->typeSize, compactor->data + compactor->first * compactor->typeSize, bytes);
+		compactor->write += compactor->last - compactor->first;
+	}
+
+	/// Keeps the elements [base + i] for every set bit i of [keep].
+	static inline void_t vector_compact_bits(vector_compactor* compactor, uint64_t keep, size_t base) {
+		while (keep != 0) {
+			size_t start = vector_ctz(keep);
+			uint64_t rest = ~(keep >> start);
+			size_t length = (rest == 0)? 64 - start : vector_ctz(rest);
+			keep = (start + length >= 64)? 0 : keep & (~0ull << (start + length));
+
+			if (base + start != compactor->last) {
+				vector_compact_flush(compactor);
+				compactor->first = base + start;
+			}
+			compactor->last = base + start + length;
+		}
+	}
+
+	/// Keeps only the elements whose bit is set in [keep] (bit i of keep[i / 64]) in one stable pass, moving each run of kept
+	///		elements with a single memmove: returns the number of elements removed.
+	size_t vector_compact(vector* vector, const uint64_t* keep) {
+		size_t count = vector_count(vector);
+		if (vector->data == NULL || count == 0 || !VECTOR_WRITABLE(vector))
+			return 0;
+
+		vector_compactor compactor = { (int08_t*) vector->data, (size_t) vector->typeSize, 0, 0, 0 };
+		for (size_t base = 0; base < count; base += 64) {
+			uint64_t bits = keep[base / 64];
+			if (count - base < 64)
+				bits &= (1ull << (count - base)) - 1;
+			vector_compact_bits(&compactor, bits, base);
+		}
+
+		vector_compact_flush(&compactor);
+		vector->iterator = compactor.write * compactor.typeSize;
+		return count - compactor.write;
+	}
+
+	/// Removes every element equal to its predecessor (after vector_qsort: all duplicates) in one stable pass: returns the
+	///		number of elements removed. [equal] NULL compares bitwise, with SIMD for 1, 2, 4 and 8 byte types.
+	size_t vector_unique(vector* vector, vector_equal_func equal) {
+		size_t count = vector_count(vector), width = (size_t) vector->typeSize;
+		if (vector->data == NULL || count < 2 || !VECTOR_WRITABLE(vector))
+			return 0;
+
+		const uint08_t* data = (const uint08_t*) vector->data;
+		bool_t blocks = equal == NULL && (width == 1 || width == 2 || width == 4 || width == 8);
+		vector_compactor compactor = { (int08_t*) vector->data, width, 0, 0, 0 };
+		for (size_t base = 0; base < count; base += 64) {
+			size_t items = VECTOR_MIN(count - base, 64), i = (base == 0)? 1 : 0;
+			uint64_t duplicates = 0;
+			for (; blocks && i + 16 / width <= items; i += 16 / width) {
+				const uint08_t* item = data + (base + i) * width;
+				duplicates |= vector_equal_block(item, item - width, width) << i;
+			}
+
+			for (; i < items; i++) {
+				const uint08_t* item = data + (base + i) * width;
+				if ((equal != NULL)? equal(item, item - width) : memcmp(item, item - width, width) == 0)
+					duplicates |= 1ull << i;
+			}
+
+			uint64_t keep = ~duplicates;
+			if (items < 64)
+				keep &= (1ull << items) - 1;
+			vector_compact_bits(&compactor, keep, base);
+		}
+
+		vector_compact_flush(&compactor);
+		vector->iterator = compactor.write * width;
+		return count - compactor.write;
+	}
+
+	/// Returns NULL if index is not within bounds iterator > index >= 0 or returns pointer to element in vector.
+	void_t* vector_get(vector* vector, size_t index) {
+		VECTOR_ASSERT(vector != NULL);
+		size_t byteIndex = index * vector->typeSize;
+		if (vector->data == NULL || byteIndex >= vector->iterator)
+			return NULL;
+
+		return (int08_t*)vector->data + byteIndex;
+	}
+
+	/// Returns a pointer to the element at [index] without NULL or bounds checks (asserted with VECTOR_DEBUG).
+	static inline void_t* vector_get_unchecked(const vector* vector, size_t index) {
+		VECTOR_ASSERT(vector != NULL && vector->data != NULL && index * vector->typeSize < vector->iterator);
+		return (int08_t*)vector->data + index * vector->typeSize;
+	}
+
+	/// Returns a pointer to the element at [index] of a vector holding [typeSize]-byte elements (asserted with VECTOR_DEBUG).
+	static inline void_t* vector_at_unchecked(const vector* vector, size_t typeSize, size_t index) {
+		VECTOR_ASSERT(vector != NULL && vector->data != NULL && (size_t)vector->typeSize == typeSize && index * typeSize < vector->iterator);
+		return (int08_t*)vector->data + index * typeSize;
+	}
+
+	/// Element [index] of a vector of T as an lvalue, with a compile-time stride and no checks (asserted with VECTOR_DEBUG).
+	///		e.g. vector_at(&vints, int32_t, i) += 1;
+	#define vector_at(vector, T, index) (*(T*)vector_at_unchecked((vector), sizeof(T), (index)))
+
+	/// Non-owning view of a run of characters: data is NOT NUL-terminated and is only valid until the vector is modified.
+	typedef struct vector_view {
+		const char_t* data; // First Character
+		size_t length;      // Length (Bytes)
+	} vector_view;
+
+	/// Returns a zero-copy view of the elements within [first, last) of a vector (clamped to the item count).
+	vector_view vector_strview(vector* vector, size_t first, size_t last) {
+		size_t count = vector_count(vector);
+		last = VECTOR_MIN(last, count);
+		first = VECTOR_MIN(first, last);
+		if (vector->data == NULL)
+			return (vector_view) { NULL, 0 };
+
+		return (vector_view) { (const char_t*) vector->data + first * vector->typeSize, (last - first) * vector->typeSize };
+	}
+
+	/// Copies the elements within [first, last) of a vector into [dest] of [capacity] bytes as a NUL-terminated string (truncated to fit):
+	///		returns the untruncated string length like snprintf, so a result >= capacity means [dest] was too small.
+	size_t vector_makestr_into(vector* vector, size_t first, size_t last, char_t* dest, size_t capacity) {
+		vector_view view = vector_strview(vector, first, last);
+		if (capacity > 0) {
+			size_t length = VECTOR_MIN(view.length, capacity - 1);
+			if (length > 0) memcpy(dest, view.data, length);
+			dest[length] = '\0';
+		}
+		return view.length;
+	}
+
+	/// Returns a pointer to a new string constructed from the elements within [first, last) of a vector (allocated by the vector's allocator):
+	///		outLen can be pointer to get length, or NULL to ignore.
+	char_t* vector_makestr(vector* vector, size_t first, size_t last, size_t* outLen) {
+		vector_view view = vector_strview(vector, first, last);
+		char_t* string = (char_t*) vector_mem_alloc(vector->allocator, (view.length + 1) * sizeof(char_t));
+		if (string != NULL && view.length > 0)
+			memcpy(string, view.data, view.length);
+
+		if (outLen != NULL)
+			(*outLen) = (string != NULL)? view.length : 0;
+		return string;
+	}
+
+	/// 
+	/// String Builder
+	///		vector_sb_* treat a vector of char_t as a growable string that is
+	///		always NUL-terminated at its iterator (the terminator is not counted),
+	///		so vector_sb_cstr() never copies. Appends grow through the vector's
+	///		growth policy and allocator and write with a single memcpy.
+	/// 
+	/// Returns TRUE if there is room for [length] more characters plus the terminator, else FALSE.
+	bool_t vector_sb_reserve(vector* vector, size_t length) {
+		VECTOR_ASSERT(vector != NULL && vector->typeSize == sizeof(char_t));
+		if (!vector_grow(vector, vector->iterator + length + 1) || !VECTOR_WRITABLE(vector))
+			return false;
+
+		((char_t*)vector->data)[vector->iterator] = '\0';
+		return true;
+	}
+
+	/// Returns a new, empty string builder with room for [length] characters (allocated from [allocator], NULL uses calloc).
+	vector vector_sb_calloc(size_t length, vector_allocator* allocator) {
+		return vector_calloc3(sizeof(char_t), length + 1, true, allocator);
+	}
+
+	/// Returns TRUE if [length] characters of [str] were appended, else FALSE.
+	bool_t vector_sb_append(vector* vector, const char_t* str, size_t length) {
+		if (!vector_sb_reserve(vector, length))
+			return false;
+
+		memcpy((char_t*)vector->data + vector->iterator, str, length);
+		vector->iterator += length;
+		((char_t*)vector->data)[vector->iterator] = '\0';
+		return true;
+	}
+
+	/// Returns TRUE if the NUL-terminated string [str] was appended, else FALSE.
+	bool_t vector_sb_appends(vector* vector, const char_t* str) {
+		return vector_sb_append(vector, str, strlen(str));
+	}
+
+	/// Returns TRUE if the character [c] was appended, else FALSE.
+	bool_t vector_sb_appendc(vector* vector, char_t c) {
+		if ((vector->iterator + 1 >= vector->length || vector->shared != NULL) && !vector_sb_reserve(vector, 1))
+			return false;
+
+		((char_t*)vector->data)[vector->iterator++] = c;
+		((char_t*)vector->data)[vector->iterator] = '\0';
+		return true;
+	}
+
+	/// Returns TRUE if the formatted string was appended (vsnprintf straight into spare capacity), else FALSE.
+	bool_t vector_sb_vappendf(vector* vector, const char_t* format, va_list args) {
+		if (!VECTOR_WRITABLE(vector))
+			return false;
+
+		va_list retry;
+		va_copy(retry, args);
+		size_t spare = (vector->data != NULL && vector->length > vector->iterator)? vector->length - vector->iterator : 0;
+		int length = vsnprintf((spare > 0)? (char_t*)vector->data + vector->iterator : NULL, spare, format, args);
+
+		if (length >= 0 && (size_t)length >= spare) {
+			if (vector_sb_reserve(vector, (size_t)length))
+				vsnprintf((char_t*)vector->data + vector->iterator, (size_t)length + 1, format, retry);
+			else length = -1;
+		}
+
+		va_end(retry);
+		if (length < 0) {
+			if (spare > 0) ((char_t*)vector->data)[vector->iterator] = '\0';
+			return false;
+		}
+
+		vector->iterator += (size_t)length;
+		return true;
+	}
+
+	/// Returns TRUE if the printf-style formatted string was appended, else FALSE.
+	bool_t vector_sb_appendf(vector* vector, const char_t* format, ...) {
+		va_list args;
+		va_start(args, format);
+		bool_t result = vector_sb_vappendf(vector, format, args);
+		va_end(args);
+		return result;
+	}
+
+	/// Returns TRUE if the decimal digits of [value] were appended (without printf), else FALSE.
+	bool_t vector_sb_append_uint(vector* vector, uint64_t value) {
+		static const char_t pairs[] =
+			"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+			"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+			"8081828384858687888990919293949596979899";
+		char_t digits[20];
+		size_t at = sizeof(digits);
+		while (value >= 100) {
+			size_t pair = (size_t)(value % 100) * 2;
+			value /= 100;
+			digits[--at] = pairs[pair + 1];
+			digits[--at] = pairs[pair];
+		}
+
+		if (value >= 10) {
+			digits[--at] = pairs[value * 2 + 1];
+			digits[--at] = pairs[value * 2];
+		} else digits[--at] = (char_t)('0' + value);
+
+		return vector_sb_append(vector, digits + at, sizeof(digits) - at);
+	}
+
+	/// Returns TRUE if the signed decimal digits of [value] were appended (without printf), else FALSE.
+	bool_t vector_sb_append_int(vector* vector, int64_t value) {
+		if (value < 0 && !vector_sb_appendc(vector, '-'))
+			return false;
+
+		return vector_sb_append_uint(vector, (value < 0)? (uint64_t)0 - (uint64_t)value : (uint64_t)value);
+	}
+
+	/// Returns the NUL-terminated contents of a string builder (valid until it is next modified).
+	const char_t* vector_sb_cstr(vector* vector) {
+		return (vector->data != NULL && vector->length > vector->iterator)? (const char_t*) vector->data : "";
+	}
+
+	/// Returns the string length (excluding the terminator) of a string builder.
+	size_t vector_sb_length(vector* vector) {
+		return vector->iterator;
+	}
+
+	/// Empties a string builder without releasing its memory.
+	void_t vector_sb_clear(vector* vector) {
+		vector->iterator = 0;
+		if (vector->data != NULL && vector->length > 0 && VECTOR_WRITABLE(vector))
+			((char_t*)vector->data)[0] = '\0';
+	}
+
+	/// Returns a pointer to a new string that is a copy of the input string.
+	char_t* vector_cpystr(const char_t* str) {
+		size_t length = strlen(str);
+		char_t* string = (char_t*) calloc(length + 1, sizeof(char_t));
+		memmove(string, str, length);
+		return string;
+	}
+
+	/// 
+	/// Serialization
+	///		vector_write()/vector_read() store a vector as a 32-byte header
+	///		followed by the raw element bytes, streamed in VECTOR_IO_CHUNK
+	///		byte chunks. Reads allocate the exact size once and fread straight
+	///		into the vector's memory. Element bytes are stored as-is, so files
+	///		written on a host of the other endianness are rejected.
+	///		
+	///			[magic 'VECI'][version u16][endian u16][typeSize u32][flags u32][count u64][checksum u64]
+	/// 
+	#define VECTOR_FORMAT_MAGIC   0x49434556u // "VECI"
+	#define VECTOR_FORMAT_VERSION 1
+	#define VECTOR_FORMAT_ENDIAN  0x0102
+
+	/// Bytes written or read per fwrite/fread call.
+	#ifndef VECTOR_IO_CHUNK
+		#define VECTOR_IO_CHUNK (1 << 20)
+	#endif
+
+	/// Serialized vector header (host byte order, see endian).
+	typedef struct vector_header {
+		uint32_t magic;    // VECTOR_FORMAT_MAGIC
+		uint16_t version;  // VECTOR_FORMAT_VERSION
+		uint16_t endian;   // VECTOR_FORMAT_ENDIAN as written by the host
+		uint32_t typeSize; // Type Size (Byte Length)
+		uint32_t flags;    // Reserved (0)
+		uint64_t count;    // Item Count
+		uint64_t checksum; // vector_checksum of the element bytes
+	} vector_header;
+
+	/// Returns [hash] updated with [size] bytes at [data] (FNV-1a over 64-bit words), start with VECTOR_CHECKSUM_SEED.
+	#define VECTOR_CHECKSUM_SEED 0xCBF29CE484222325ull
+	uint64_t vector_checksum(uint64_t hash, const void_t* data, size_t size) {
+		const uint08_t* bytes = (const uint08_t*) data;
+		size_t i = 0;
+		for (; i + 8 <= size; i += 8) {
+			uint64_t word;
+			memcpy(&word, bytes + i, 8);
+			hash = (hash ^ word) * 0x100000001B3ull;
+		}
+
+		for (; i < size; i++)
+			hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+		return hash;
+	}
+
+	/// Returns TRUE if the header and elements of the vector were written to [file], else FALSE.
+	bool_t vector_write(vector* vector, FILE* file) {
+		vector_header header = { VECTOR_FORMAT_MAGIC, VECTOR_FORMAT_VERSION, VECTOR_FORMAT_ENDIAN, (uint32_t)vector->typeSize, 0,
+			vector_count(vector), vector_checksum(VECTOR_CHECKSUM_SEED, vector->data, (vector->data != NULL)? vector->iterator : 0) };
+		if (fwrite(&header, sizeof(header), 1, file) != 1)
+			return false;
+
+		for (size_t offset = 0; offset < vector->iterator; offset += VECTOR_IO_CHUNK) {
+			size_t chunk = VECTOR_MIN(vector->iterator - offset, (size_t)VECTOR_IO_CHUNK);
+			if (fwrite((int08_t*)vector->data + offset, 1, chunk, file) != chunk)
+				return false;
+		}
+
+		return true;
+	}
+
+	/// Returns TRUE if a vector written by vector_write was read from [file] into [vector] (allocated from [allocator], NULL uses malloc), else FALSE.
+	///		On failure [vector] is left unallocated. Any previous contents of [vector] are not free'd.
+	bool_t vector_read(vector* vector, FILE* file, vector_allocator* allocator) {
+		vector_header header;
+		*vector = vector_calloc3(1, 0, false, allocator);
+		if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != VECTOR_FORMAT_MAGIC || header.version != VECTOR_FORMAT_VERSION
+			|| header.endian != VECTOR_FORMAT_ENDIAN || header.typeSize == 0 || header.typeSize > INT32_MAX || header.count > SIZE_MAX / header.typeSize)
+			return false;
+
+		size_t bytes = (size_t)header.count * header.typeSize;
+		vector->typeSize = (int32_t)header.typeSize;
+		if (bytes == 0)
+			return header.checksum == VECTOR_CHECKSUM_SEED;
+
+		int08_t* data = (int08_t*) vector_mem_realloc(allocator, NULL, 0, bytes);
+		if (data == NULL)
+			return false;
+
+		uint64_t checksum = VECTOR_CHECKSUM_SEED;
+		for (size_t offset = 0; offset < bytes; offset += VECTOR_IO_CHUNK) {
+			size_t chunk = VECTOR_MIN(bytes - offset, (size_t)VECTOR_IO_CHUNK);
+			if (fread(data + offset, 1, chunk, file) != chunk) {
+				vector_mem_free(allocator, data, bytes);
+				return false;
+			}
+			checksum = vector_checksum(checksum, data + offset, chunk);
+		}
+
+		if (checksum != header.checksum) {
+			vector_mem_free(allocator, data, bytes);
+			return false;
+		}
+
+		vector->data = data;
+		vector->length = vector->iterator = bytes;
+		return true;
+	}
+
+	#ifdef VECTOR_THREADS
+		/// 
+		/// Ring Buffer (single producer, single consumer)
+		///		vector_ring stores typeSize-byte records in a vector with power-of-two
+		///		capacity. One producer thread pushes and one consumer thread pops
+		///		without locks: head and tail are atomics on separate cache lines,
+		///		and each side caches the other's index so it only touches the
+		///		shared line when the ring looks full (or empty). Batch push/pop move
+		///		records with at most two memcpy calls.
+		/// 
+		typedef struct vector_ring {
+			_Alignas(VECTOR_CACHE_LINE) atomic_size_t head; // Consumer Position (Items, written by the consumer)
+			size_t tailCache;                                 // Consumer's copy of tail
+			_Alignas(VECTOR_CACHE_LINE) atomic_size_t tail; // Producer Position (Items, written by the producer)
+			size_t headCache;                                 // Producer's copy of head
+			_Alignas(VECTOR_CACHE_LINE) vector buffer;      // Record Storage (capacity is a power of two)
+			size_t mask;                                      // Capacity - 1
+		} vector_ring;
+
+		/// Returns TRUE if the ring was initialized with room for at least [capacity] records (rounded up to a power of two), else FALSE.
+		bool_t vector_ring_init(vector_ring* ring, int32_t typeSize, size_t capacity, vector_allocator* allocator) {
+			VECTOR_ASSERT(ring != NULL && typeSize > 0);
+			size_t size = 1;
+			while (size < capacity) size <<= 1;
+
+			ring->buffer = vector_calloc3(typeSize, size, true, allocator);
+			ring->mask = size - 1;
+			ring->headCache = ring->tailCache = 0;
+			atomic_init(&ring->head, 0);
+			atomic_init(&ring->tail, 0);
+			return ring->buffer.data != NULL;
+		}
+
+		/// Frees the ring storage (no thread may be using the ring).
+		void_t vector_ring_free(vector_ring* ring) {
+			vector_free(&ring->buffer);
+		}
+
+		/// Returns the record capacity of the ring.
+		size_t vector_ring_capacity(vector_ring* ring) {
+			return ring->mask + 1;
+		}
+
+		/// Returns the number of records in the ring (a snapshot when called concurrently).
+		size_t vector_ring_count(vector_ring* ring) {
+			size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+			return atomic_load_explicit(&ring->tail, memory_order_acquire) - head;
+		}
+
+		/// Copies [count] records between ring slots starting at [position] and [items] (toRing selects the direction).
+		void_t vector_ring_copy(vector_ring* ring, size_t position, void_t* items, size_t count, bool_t toRing) {
+			size_t typeSize = (size_t)ring->buffer.typeSize, index = position & ring->mask;
+			size_t first = VECTOR_MIN(count, ring->mask + 1 - index);
+			int08_t* slot = (int08_t*)ring->buffer.data + index * typeSize;
+			if (toRing) {
+				memcpy(slot, items, first * typeSize);
+				memcpy(ring->buffer.data, (int08_t*)items + first * typeSize, (count - first) * typeSize);
+			} else {
+				memcpy(items, slot, first * typeSize);
+				memcpy((int08_t*)items + first * typeSize, ring->buffer.data, (count - first) * typeSize);
+			}
+		}
+
+		/// Producer: pushes up to [count] records from [items] and returns the number pushed (0 if full).
+		size_t vector_ring_push_range(vector_ring* ring, const void_t* items, size_t count) {
+			VECTOR_ASSERT(ring != NULL && (items != NULL || count == 0));
+			size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+			size_t capacity = ring->mask + 1;
+			if (tail - ring->headCache + count > capacity)
+				ring->headCache = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+			count = VECTOR_MIN(count, capacity - (tail - ring->headCache));
+			if (count == 0)
+				return 0;
+
+			vector_ring_copy(ring, tail, (void_t*) items, count, true);
+			atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+			return count;
+		}
+
+		/// Consumer: pops up to [count] records into [items] and returns the number popped (0 if empty).
+		size_t vector_ring_pop_range(vector_ring* ring, void_t* items, size_t count) {
+			VECTOR_ASSERT(ring != NULL && (items != NULL || count == 0));
+			size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+			if (ring->tailCache - head < count)
+				ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+			count = VECTOR_MIN(count, ring->tailCache - head);
+			if (count == 0)
+				return 0;
+
+			vector_ring_copy(ring, head, items, count, false);
+			atomic_store_explicit(&ring->head, head + count, memory_order_release);
+			return count;
+		}
+
+		/// Producer: returns TRUE if [item] was pushed, else FALSE (ring full).
+		bool_t vector_ring_push(vector_ring* ring, const void_t* item) {
+			return vector_ring_push_range(ring, item, 1) == 1;
+		}
+
+		/// Consumer: returns TRUE if a record was popped into [item], else FALSE (ring empty).
+		bool_t vector_ring_pop(vector_ring* ring, void_t* item) {
+			return vector_ring_pop_range(ring, item, 1) == 1;
+		}
+	#endif
+
+	#ifdef VECTOR_THREADS
+		/// 
+		/// Concurrent Append Vector (multiple producers)
+		///		vector_mt lets many threads append at once: each push reserves its
+		///		slots with one atomic fetch-add on the iterator and copies into a
+		///		segment. Segment k holds firstSegment << k items and is never moved,
+		///		so element pointers stay valid and appenders never wait on a realloc
+		///		(the first thread to touch a new segment allocates it with a CAS).
+		///		Once every producer is done, vector_mt_seal() flattens the segments
+		///		into a regular contiguous vector for the consumer phase.
+		///		
+		///		The allocator (NULL uses calloc) must be thread-safe.
+		/// 
+		#define VECTOR_MT_SEGMENTS 64
+
+		typedef struct vector_mt {
+			_Alignas(VECTOR_CACHE_LINE) atomic_size_t iterator; // Next Free Slot (Items)
+			_Alignas(VECTOR_CACHE_LINE) int32_t typeSize;      // Type Size (Byte Length)
+			size_t shift;                                        // log2 of the first segment's item count
+			vector_allocator* allocator;                         // Allocator (NULL for calloc/free)
+			_Atomic(int08_t*) segments[VECTOR_MT_SEGMENTS];      // Segment k holds (1 << shift) << k items
+		} vector_mt;
+
+		/// Initializes an empty concurrent vector whose first segment holds [firstSegment] items (rounded up to a power of two).
+		void_t vector_mt_init(vector_mt* mt, int32_t typeSize, size_t firstSegment, vector_allocator* allocator) {
+			mt->typeSize = typeSize;
+			mt->shift = vector_msb(VECTOR_MAX(firstSegment, 1) * 2 - 1);
+			mt->allocator = allocator;
+			atomic_init(&mt->iterator, 0);
+			for (size_t i = 0; i < VECTOR_MT_SEGMENTS; i++)
+				atomic_init(&mt->segments[i], NULL);
+		}
+
+		/// Returns (in [offset]) the item offset of [index] within its segment, and the segment index.
+		size_t vector_mt_segment(vector_mt* mt, size_t index, size_t* offset) {
+			size_t segment = vector_msb((index >> mt->shift) + 1);
+			*offset = index - (((size_t)1 << (mt->shift + segment)) - ((size_t)1 << mt->shift));
+			return segment;
+		}
+
+		/// Returns the (allocated on first use) memory of [segment], or NULL if it cannot be allocated.
+		int08_t* vector_mt_acquire(vector_mt* mt, size_t segment) {
+			int08_t* data = atomic_load_explicit(&mt->segments[segment], memory_order_acquire);
+			if (data != NULL)
+				return data;
+
+			size_t bytes = ((size_t)1 << (mt->shift + segment)) * (size_t)mt->typeSize;
+			int08_t* fresh = (int08_t*) vector_mem_realloc(mt->allocator, NULL, 0, bytes);
+			if (fresh == NULL)
+				return NULL;
+
+			if (atomic_compare_exchange_strong_explicit(&mt->segments[segment], &data, fresh, memory_order_acq_rel, memory_order_acquire))
+				return fresh;
+
+			vector_mem_free(mt->allocator, fresh, bytes);
+			return data;
+		}
+
+		/// Returns a stable pointer to the element at [index] (index must be below the count reserved so far).
+		void_t* vector_mt_get(vector_mt* mt, size_t index) {
+			size_t offset, segment = vector_mt_segment(mt, index, &offset);
+			int08_t* data = atomic_load_explicit(&mt->segments[segment], memory_order_acquire);
+			return (data != NULL)? data + offset * mt->typeSize : NULL;
+		}
+
+		/// Returns the number of slots reserved by pushes so far.
+		size_t vector_mt_count(vector_mt* mt) {
+			return atomic_load_explicit(&mt->iterator, memory_order_acquire);
+		}
+
+		/// Thread-safe: appends [count] elements from [data] to consecutive slots. Returns the index of the first slot, or SIZE_MAX on allocation failure.
+		///		A failed push gives its slots back if no other push reserved slots after it, else they stay counted as a hole
+		///		of unwritten items: vector_mt_seal() then fails if the hole lies in a segment that was never allocated.
+		size_t vector_mt_push_range(vector_mt* mt, const void_t* data, size_t count) {
+			size_t first = atomic_fetch_add_explicit(&mt->iterator, count, memory_order_relaxed);
+			const int08_t* source = (const int08_t*) data;
+			for (size_t index = first, remaining = count; remaining > 0;) {
+				size_t offset, segment = vector_mt_segment(mt, index, &offset);
+				int08_t* dest = vector_mt_acquire(mt, segment);
+				if (dest == NULL) {
+					size_t last = first + count;
+					atomic_compare_exchange_strong_explicit(&mt->iterator, &last, first, memory_order_relaxed, memory_order_relaxed);
+					return SIZE_MAX;
+				}
+
+				size_t chunk = VECTOR_MIN(remaining, ((size_t)1 << (mt->shift + segment)) - offset);
+				memcpy(dest + offset * mt->typeSize, source, chunk * mt->typeSize);
+				source += chunk * mt->typeSize;
+				index += chunk;
+				remaining -= chunk;
+			}
+			return first;
+		}
+
+		/// Thread-safe: appends the element at [data]. Returns its slot index, or SIZE_MAX on allocation failure.
+		size_t vector_mt_push(vector_mt* mt, const void_t* data) {
+			return vector_mt_push_range(mt, data, 1);
+		}
+
+		/// Frees every segment of the concurrent vector (no thread may be pushing).
+		void_t vector_mt_free(vector_mt* mt) {
+			for (size_t i = 0; i + mt->shift < VECTOR_MT_SEGMENTS; i++) {
+				int08_t* data = atomic_exchange(&mt->segments[i], NULL);
+				if (data != NULL)
+					vector_mem_free(mt->allocator, data, ((size_t)1 << (mt->shift + i)) * (size_t)mt->typeSize);
+			}
+			atomic_store(&mt->iterator, 0);
+		}
+
+		/// Returns a contiguous vector (from the same allocator) holding every pushed element in slot order, and empties [mt].
+		///		Call once all producers are done. On allocation failure (or a hole left by a failed push in a segment that
+		///		was never allocated) the result is unallocated and [mt] is left untouched.
+		vector vector_mt_seal(vector_mt* mt) {
+			size_t count = vector_mt_count(mt);
+			vector result = vector_calloc3(mt->typeSize, 0, false, mt->allocator);
+			if (count == 0) {
+				vector_mt_free(mt);
+				return result;
+			}
+
+			int08_t* data = (int08_t*) vector_mem_realloc(mt->allocator, NULL, 0, count * (size_t)mt->typeSize);
+			if (data == NULL)
+				return result;
+
+			for (size_t index = 0, segment = 0; index < count; segment++) {
+				size_t chunk = VECTOR_MIN(count - index, (size_t)1 << (mt->shift + segment));
+				int08_t* source = atomic_load(&mt->segments[segment]);
+				if (source == NULL) {
+					vector_mem_free(mt->allocator, data, count * (size_t)mt->typeSize);
+					return result;
+				}
+
+				vector_copy_bytes(data + index * mt->typeSize, source, chunk * mt->typeSize);
+				index += chunk;
+			}
+
+			vector_mt_free(mt);
+			result.data = data;
+			result.length = result.iterator = count * (size_t)mt->typeSize;
+			return result;
+		}
+	#endif
+
+	/// 
+	/// Parallel Loops
+	///		vector_parallel_for()/vector_parallel_reduce() split the element range
+	///		of a vector into chunks of [grain] items (0 picks a grain) and run them
+	///		on a small built-in pool of worker threads plus the calling thread.
+	///		Every participant starts with a contiguous block of chunks and, once
+	///		it runs dry, steals half of the remaining chunks of another
+	///		participant, so uneven work balances out. Below
+	///		VECTOR_PARALLEL_THRESHOLD items (or without VECTOR_THREADS) the
+	///		callback runs once over the whole range on the calling thread.
+	///		
+	///		The pool starts on first use with one worker per hardware thread
+	///		(or call vector_workers_start) and runs one loop at a time: do not
+	///		start parallel loops from several threads at once or from inside
+	///		a callback. vector_workers_stop() joins the workers.
+	///		
+	///		vector_first_touch() writes every page of a reserved range through
+	///		the same chunking, so on NUMA machines each page is placed on the
+	///		node of the thread that later processes it with the same [grain].
+	/// 
+	#ifndef VECTOR_PARALLEL_THRESHOLD
+		#define VECTOR_PARALLEL_THRESHOLD 32768
+	#endif
+
+	#ifndef VECTOR_WORKERS_MAX
+		#define VECTOR_WORKERS_MAX 64
+	#endif
+
+	/// Stride in bytes between the writes of vector_first_touch (the smallest page size in use).
+	#ifndef VECTOR_PAGE_SIZE
+		#define VECTOR_PAGE_SIZE 4096
+	#endif
+
+	/// Loop body: processes the elements within [first, last) of [vector].
+	typedef void_t (*vector_range_func)(vector* vector, size_t first, size_t last, void_t* context);
+	/// Reduce body: accumulates the elements within [first, last) of [vector] into [partial].
+	typedef void_t (*vector_reduce_func)(vector* vector, size_t first, size_t last, void_t* partial, void_t* context);
+	/// Combine: merges [other] into [partial] (must be associative and commutative).
+	typedef void_t (*vector_combine_func)(void_t* partial, const void_t* other, void_t* context);
+
+	#ifdef VECTOR_THREADS
+		typedef struct vector_job {
+			vector* vector;
+			vector_range_func loop;
+			vector_reduce_func reduce;
+			void_t* context;
+			int08_t* partials;  // One partial result per participant, partialSize bytes apart (reduce only)
+			size_t partialSize;
+			size_t count, grain, participants;
+			struct { _Alignas(VECTOR_CACHE_LINE) _Atomic(uint64_t) chunks; } ranges[VECTOR_WORKERS_MAX]; // [first chunk | end chunk << 32]
+		} vector_job;
+
+		struct vector_workers {
+			vector_mutex mutex;
+			vector_cond start, done;
+			vector_thread threads[VECTOR_WORKERS_MAX];
+			size_t count, active, generation;
+			vector_job* job;
+			bool_t running, stopping;
+		} vector_workers;
+
+		/// Returns TRUE if a chunk index was taken from participant [index] (front for the owner, back half for thieves), else FALSE.
+		bool_t vector_job_take(vector_job* job, size_t owner, size_t index, size_t* chunk) {
+			_Atomic(uint64_t)* range = &job->ranges[index].chunks;
+			uint64_t value = atomic_load_explicit(range, memory_order_acquire);
+			for (;;) {
+				uint64_t first = value & 0xFFFFFFFFu, end = value >> 32;
+				if (first >= end)
+					return false;
+
+				if (owner == index) {
+					if (atomic_compare_exchange_weak_explicit(range, &value, (first + 1) | (end << 32), memory_order_acq_rel, memory_order_acquire)) {
+						*chunk = (size_t)first;
+						return true;
+					}
+					continue;
+				}
+
+				uint64_t split = end - (end - first + 1) / 2;
+				if (atomic_compare_exchange_weak_explicit(range, &value, first | (split << 32), memory_order_acq_rel, memory_order_acquire)) {
+					atomic_store_explicit(&job->ranges[owner].chunks, (split + 1) | (end << 32), memory_order_release);
+					*chunk = (size_t)split;
+					return true;
+				}
+			}
+		}
+
+		/// Runs chunks of [job] as participant [owner] until no participant has any left.
+		void_t vector_job_run(vector_job* job, size_t owner) {
+			size_t chunk;
+			for (;;) {
+				bool_t found = vector_job_take(job, owner, owner, &chunk);
+				for (size_t i = 1; !found && i < job->participants; i++)
+					found = vector_job_take(job, owner, (owner + i) % job->participants, &chunk);
+				if (!found)
+					return;
+
+				size_t first = chunk * job->grain, last = VECTOR_MIN(first + job->grain, job->count);
+				if (job->reduce != NULL) job->reduce(job->vector, first, last, job->partials + owner * job->partialSize, job->context);
+				else job->loop(job->vector, first, last, job->context);
+			}
+		}
+
+		void_t vector_workers_main(void_t* task) {
+			size_t index = (size_t)(uintptr_t) task, seen = 0;
+			vector_mutex_lock(&vector_workers.mutex);
+			for (;;) {
+				while (vector_workers.generation == seen && !vector_workers.stopping)
+					vector_cond_wait(&vector_workers.start, &vector_workers.mutex);
+				if (vector_workers.stopping)
+					break;
+
+				seen = vector_workers.generation;
+				vector_job* job = vector_workers.job;
+				vector_mutex_unlock(&vector_workers.mutex);
+				if (index < job->participants)
+					vector_job_run(job, index);
+
+				vector_mutex_lock(&vector_workers.mutex);
+				if (--vector_workers.active == 0)
+					vector_cond_broadcast(&vector_workers.done);
+			}
+			vector_mutex_unlock(&vector_workers.mutex);
+		}
+
+		/// Returns the number of pool workers started (0 if the pool could not start), starting [threads] - 1 workers (0 for one per hardware thread) if not running.
+		size_t vector_workers_start(size_t threads) {
+			if (vector_workers.running)
+				return vector_workers.count;
+
+			threads = VECTOR_MIN((threads > 0)? threads : vector_thread_count(), VECTOR_WORKERS_MAX);
+			vector_mutex_init(&vector_workers.mutex);
+			vector_cond_init(&vector_workers.start);
+			vector_cond_init(&vector_workers.done);
+			vector_workers.count = vector_workers.active = vector_workers.generation = 0;
+			vector_workers.stopping = false;
+			vector_workers.running = true;
+			for (size_t i = 1; i < threads; i++, vector_workers.count++)
+				if (!vector_thread_create(&vector_workers.threads[i - 1], vector_workers_main, (void_t*)(uintptr_t) i))
+					break;
+			return vector_workers.count;
+		}
+
+		/// Stops and joins the pool workers (no parallel loop may be running).
+		void_t vector_workers_stop(void_t) {
+			if (!vector_workers.running)
+				return;
+
+			vector_mutex_lock(&vector_workers.mutex);
+			vector_workers.stopping = true;
+			vector_cond_broadcast(&vector_workers.start);
+			vector_mutex_unlock(&vector_workers.mutex);
+			for (size_t i = 0; i < vector_workers.count; i++)
+				vector_thread_join(vector_workers.threads[i]);
+
+			vector_cond_destroy(&vector_workers.start);
+			vector_cond_destroy(&vector_workers.done);
+			vector_mutex_destroy(&vector_workers.mutex);
+			vector_workers.running = false;
+			vector_workers.count = 0;
+		}
+
+		/// Runs [job] on the pool and the calling thread, returns once every chunk is done.
+		void_t vector_job_submit(vector_job* job) {
+			size_t chunks = (job->count + job->grain - 1) / job->grain;
+			for (size_t i = 0; i < job->participants; i++)
+				atomic_init(&job->ranges[i].chunks, (uint64_t)(chunks * i / job->participants) | ((uint64_t)(chunks * (i + 1) / job->participants) << 32));
+
+			vector_mutex_lock(&vector_workers.mutex);
+			vector_workers.job = job;
+			vector_workers.active = vector_workers.count;
+			vector_workers.generation++;
+			vector_cond_broadcast(&vector_workers.start);
+			vector_mutex_unlock(&vector_workers.mutex);
+
+			vector_job_run(job, 0);
+
+			vector_mutex_lock(&vector_workers.mutex);
+			while (vector_workers.active > 0)
+				vector_cond_wait(&vector_workers.done, &vector_workers.mutex);
+			vector_mutex_unlock(&vector_workers.mutex);
+		}
+
+		/// Returns the job for [count] items split in [grain] item chunks over every pool participant, or 1 participant if the pool is unavailable.
+		void_t vector_job_prepare(vector_job* job, size_t count, size_t grain) {
+			job->participants = vector_workers_start(0) + 1;
+			size_t chunks = (grain > 0)? (count + grain - 1) / grain : job->participants * 8;
+			chunks = VECTOR_MIN(VECTOR_MAX(chunks, 1), (size_t)0xFFFFFFFFu);
+			job->count = count;
+			job->grain = (count + chunks - 1) / chunks;
+			job->participants = VECTOR_MIN(job->participants, chunks);
+		}
+	#endif
+
+	/// Calls [loop] over chunks of the vector's elements in parallel (serially below VECTOR_PARALLEL_THRESHOLD items).
+	void_t vector_parallel_for(vector* vector, vector_range_func loop, void_t* context, size_t grain) {
+		size_t count = vector_count(vector);
+		#ifdef VECTOR_THREADS
+			if (count >= VECTOR_PARALLEL_THRESHOLD && vector_workers_start(0) > 0) {
+				vector_job job;
+				job.vector = vector;
+				job.loop = loop;
+				job.reduce = NULL;
+				job.context = context;
+				job.partials = NULL;
+				job.partialSize = 0;
+				vector_job_prepare(&job, count, grain);
+				vector_job_submit(&job);
+				return;
+			}
+		#else
+			(void_t) grain;
+		#endif
+
+		if (count > 0)
+			loop(vector, 0, count, context);
+	}
+
+	void_t vector_touch_range(vector* vector, size_t first, size_t last, void_t* context) {
+		(void_t) context;
+		volatile int08_t* bytes = (volatile int08_t*) vector->data;
+		size_t end = last * (size_t)vector->typeSize;
+		for (size_t i = first * (size_t)vector->typeSize; i < end; i += VECTOR_PAGE_SIZE)
+			bytes[i] = bytes[i];
+		bytes[end - 1] = bytes[end - 1];
+	}
+
+	/// Returns TRUE if the pages under the first [count] items of the vector's capacity were first touched in parallel, else FALSE.
+	///		Every byte keeps its value: each participant rewrites one byte per page of its chunks, which faults the page in
+	///		on the participant's NUMA node. Call it right after reserving (before the pages are written by one thread) and
+	///		process the vector with vector_parallel_for over the same count and [grain] so each thread meets local pages.
+	bool_t vector_first_touch(vector* vector, size_t count, size_t grain) {
+		if (vector->data == NULL || count == 0 || !VECTOR_WRITABLE(vector))
+			return false;
+
+		size_t iterator = vector->iterator;
+		vector->iterator = VECTOR_MIN(count * (size_t)vector->typeSize, vector->length);
+		vector_parallel_for(vector, vector_touch_range, NULL, grain);
+		vector->iterator = iterator;
+		return true;
+	}
+
+	/// Returns TRUE if the vector's elements were reduced in parallel into [result] of [resultSize] bytes, else FALSE.
+	///		[result] must hold the identity value: every participant starts a partial from it, [reduce] accumulates chunks
+	///		into partials and [combine] merges them into [result]. Serial below VECTOR_PARALLEL_THRESHOLD items.
+	bool_t vector_parallel_reduce(vector* vector, vector_reduce_func reduce, vector_combine_func combine, void_t* result, size_t resultSize, void_t* context, size_t grain) {
+		size_t count = vector_count(vector);
+		#ifdef VECTOR_THREADS
+			if (count >= VECTOR_PARALLEL_THRESHOLD && vector_workers_start(0) > 0) {
+				vector_job job;
+				job.vector = vector;
+				job.loop = NULL;
+				job.reduce = reduce;
+				job.context = context;
+				job.partialSize = (resultSize + VECTOR_CACHE_LINE - 1) & ~(size_t)(VECTOR_CACHE_LINE - 1);
+				vector_job_prepare(&job, count, grain);
+
+				job.partials = (int08_t*) malloc(job.partialSize * job.participants);
+				if (job.partials == NULL)
+					return false;
+
+				for (size_t i = 0; i < job.participants; i++)
+					memcpy(job.partials + i * job.partialSize, result, resultSize);
+
+				vector_job_submit(&job);
+				for (size_t i = 0; i < job.participants; i++)
+					combine(result, job.partials + i * job.partialSize, context);
+
+				free(job.partials);
+				return true;
+			}
+		#else
+			(void_t) combine;
+			(void_t) resultSize;
+			(void_t) grain;
+		#endif
+
+		if (count > 0)
+			reduce(vector, 0, count, result, context);
+		return true;
+	}
+
+	/// 
+	/// Structure of Arrays
+	///		vector_soa keeps up to VECTOR_SOA_COLUMNS parallel column vectors with
+	///		independent type sizes under one shared count, so kernels that read
+	///		one or two fields stream only those columns. Every column is
+	///		allocated VECTOR_SOA_ALIGN-byte aligned (vector_aligned) for SIMD
+	///		loads, and push/insert/remove/remove_swap keep all columns in sync.
+	///		Rows are passed as one pointer per column (values[column]).
+	/// 
+	#ifndef VECTOR_SOA_COLUMNS
+		#define VECTOR_SOA_COLUMNS 16
+	#endif
+
+	#ifndef VECTOR_SOA_ALIGN
+		#define VECTOR_SOA_ALIGN VECTOR_CACHE_LINE
+	#endif
+
+	typedef struct vector_soa {
+		vector columns[VECTOR_SOA_COLUMNS]; // Column Vectors (same item count)
+		size_t columnCount;                 // Column Count
+	} vector_soa;
+
+	/// Frees every column.
+	void_t vector_soa_free(vector_soa* soa) {
+		for (size_t c = 0; c < soa->columnCount; c++)
+			vector_free(&soa->columns[c]);
+	}
+
+	/// Returns TRUE if the columns ([columnCount] type sizes) were allocated with room for [length] rows, else FALSE.
+	///		On failure (more than VECTOR_SOA_COLUMNS columns, or an allocation failed) nothing stays allocated and
+	///		the columnCount is 0, so there is nothing to vector_soa_free.
+	bool_t vector_soa_init(vector_soa* soa, const int32_t* typeSizes, size_t columnCount, size_t length) {
+		soa->columnCount = 0;
+		if (columnCount > VECTOR_SOA_COLUMNS)
+			return false;
+
+		for (size_t c = 0; c < columnCount; c++) {
+			soa->columns[c] = vector_calloc_aligned(typeSizes[c], length, length > 0, VECTOR_SOA_ALIGN);
+			soa->columnCount = c + 1;
+			if (soa->columns[c].allocator == NULL || (length > 0 && soa->columns[c].data == NULL)) {
+				vector_soa_free(soa);
+				soa->columnCount = 0;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Returns the shared row count.
+	size_t vector_soa_count(vector_soa* soa) {
+		return (soa->columnCount > 0)? vector_count(&soa->columns[0]) : 0;
+	}
+
+	/// Returns the VECTOR_SOA_ALIGN-aligned data of [column] (invalidated when rows are added past capacity).
+	void_t* vector_soa_column(vector_soa* soa, size_t column) {
+		VECTOR_ASSERT(column < soa->columnCount);
+		return soa->columns[column].data;
+	}
+
+	/// Returns a pointer to the element of [column] at row [index], or NULL if out of bounds.
+	void_t* vector_soa_get(vector_soa* soa, size_t column, size_t index) {
+		return (column < soa->columnCount)? vector_get(&soa->columns[column], index) : NULL;
+	}
+
+	/// Returns TRUE if every column can hold at least [length] rows, else FALSE.
+	bool_t vector_soa_reserve(vector_soa* soa, size_t length) {
+		for (size_t c = 0; c < soa->columnCount; c++)
+			if (!vector_reserve(&soa->columns[c], length))
+				return false;
+		return true;
+	}
+
+	/// Returns TRUE if the row (one pointer per column in [values]) was inserted at [index] in every column, else FALSE.
+	bool_t vector_soa_insert(vector_soa* soa, const void_t* const* values, size_t index) {
+		size_t count = vector_soa_count(soa);
+		if (index > count)
+			return false;
+
+		for (size_t c = 0; c < soa->columnCount; c++)
+			if (!vector_grow(&soa->columns[c], count + 1))
+				return false;
+
+		for (size_t c = 0; c < soa->columnCount; c++)
+			vector_insert(&soa->columns[c], (void_t*) values[c], index);
+		return true;
+	}
+
+	/// Returns TRUE if the row (one pointer per column in [values]) was appended to every column, else FALSE.
+	bool_t vector_soa_push(vector_soa* soa, const void_t* const* values) {
+		return vector_soa_insert(soa, values, vector_soa_count(soa));
+	}
+
+	/// Returns TRUE if row [index] was removed from every column (order is kept), else FALSE.
+	bool_t vector_soa_remove(vector_soa* soa, size_t index) {
+		if (index >= vector_soa_count(soa))
+			return false;
+
+		for (size_t c = 0; c < soa->columnCount; c++)
+			vector_remove(&soa->columns[c], index);
+		return true;
+	}
+
+	/// Returns TRUE if row [index] was replaced by the last row in every column (order is not kept), else FALSE.
+	bool_t vector_soa_remove_swap(vector_soa* soa, size_t index) {
+		if (index >= vector_soa_count(soa))
+			return false;
+
+		for (size_t c = 0; c < soa->columnCount; c++)
+			vector_remove_swap(&soa->columns[c], index);
+		return true;
+	}
+
+	/// 
+	/// Segmented Vectors
+	///		vector_seg stores elements in fixed power-of-two chunks listed in a
+	///		chunk table (a vector of chunk pointers). Growth allocates one more
+	///		chunk and never copies or moves existing elements, so pointers from
+	///		vector_seg_get stay valid until the element is popped or the vector
+	///		is free'd. Index math is a shift and a mask. Iterate chunk by chunk
+	///		with vector_seg_chunk, or copy into a contiguous vector with
+	///		vector_seg_flatten.
+	/// 
+	#ifndef VECTOR_SEG_CHUNK
+		#define VECTOR_SEG_CHUNK 4096
+	#endif
+
+	typedef struct vector_seg {
+		vector chunks;               // Chunk Table (int08_t* per chunk)
+		int32_t typeSize;            // Type Size (Byte Length)
+		size_t count;                // Current Count (Items)
+		size_t shift;                // Chunk Size (1 << shift Items)
+		vector_allocator* allocator; // Chunk Allocator (NULL for malloc/free)
+	} vector_seg;
+
+	/// Returns TRUE if the segmented vector was initialized with chunks of [chunkItems] items (rounded up to a power of two,
+	///		0 for VECTOR_SEG_CHUNK) from [allocator] (NULL uses malloc), else FALSE. No chunk is allocated until the first push.
+	bool_t vector_seg_init(vector_seg* seg, int32_t typeSize, size_t chunkItems, vector_allocator* allocator) {
+		VECTOR_ASSERT(seg != NULL && typeSize > 0);
+		chunkItems = (chunkItems > 0)? chunkItems : VECTOR_SEG_CHUNK;
+		seg->shift = vector_msb(chunkItems);
+		seg->shift += ((size_t) 1 << seg->shift) < chunkItems;
+		seg->typeSize = typeSize;
+		seg->count = 0;
+		seg->allocator = allocator;
+		seg->chunks = vector_calloc3(sizeof(int08_t*), 0, false, allocator);
+		return typeSize > 0;
+	}
+
+	/// Returns the number of chunks allocated.
+	size_t vector_seg_chunks(vector_seg* seg) {
+		return vector_count(&seg->chunks);
+	}
+
+	/// Frees every chunk and the chunk table.
+	void_t vector_seg_free(vector_seg* seg) {
+		size_t chunkBytes = ((size_t) 1 << seg->shift) * seg->typeSize;
+		for (size_t k = 0; k < vector_seg_chunks(seg); k++)
+			vector_mem_free(seg->allocator, vector_at(&seg->chunks, int08_t*, k), chunkBytes);
+		vector_free(&seg->chunks);
+		seg->count = 0;
+	}
+
+	/// Returns the item count.
+	size_t vector_seg_count(vector_seg* seg) {
+		return seg->count;
+	}
+
+	/// Returns the number of items that fit in the allocated chunks.
+	size_t vector_seg_capacity(vector_seg* seg) {
+		return vector_seg_chunks(seg) << seg->shift;
+	}
+
+	/// Returns a pointer to the element at [index] (stable until it is popped), or NULL if out of bounds.
+	void_t* vector_seg_get(vector_seg* seg, size_t index) {
+		VECTOR_ASSERT(seg != NULL);
+		if (index >= seg->count)
+			return NULL;
+		int08_t* chunk = vector_at(&seg->chunks, int08_t*, index >> seg->shift);
+		return chunk + (index & (((size_t) 1 << seg->shift) - 1)) * seg->typeSize;
+	}
+
+	/// Returns the first element of chunk [chunk] and writes its live item count to [count], or NULL if out of bounds.
+	void_t* vector_seg_chunk(vector_seg* seg, size_t chunk, size_t* count) {
+		VECTOR_ASSERT(seg != NULL && count != NULL);
+		size_t first = chunk << seg->shift;
+		if (first >= seg->count) {
+			*count = 0;
+			return NULL;
+		}
+
+		*count = VECTOR_MIN(seg->count - first, (size_t) 1 << seg->shift);
+		return vector_at(&seg->chunks, int08_t*, chunk);
+	}
+
+	/// Returns TRUE if the allocated chunks can hold at least [count] items (existing elements never move), else FALSE.
+	bool_t vector_seg_reserve(vector_seg* seg, size_t count) {
+		VECTOR_ASSERT(seg != NULL);
+		size_t chunkBytes = ((size_t) 1 << seg->shift) * seg->typeSize;
+		while (vector_seg_capacity(seg) < count) {
+			int08_t* chunk = (int08_t*) vector_mem_realloc(seg->allocator, NULL, 0, chunkBytes);
+			if (chunk == NULL)
+				return false;
+
+			if (!vector_insert(&seg->chunks, &chunk, vector_seg_chunks(seg))) {
+				vector_mem_free(seg->allocator, chunk, chunkBytes);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// Returns TRUE if [count] elements from [data] were appended (copied chunk by chunk), else FALSE.
+	bool_t vector_seg_append_range(vector_seg* seg, const void_t* data, size_t count) {
+		VECTOR_ASSERT(seg != NULL && (data != NULL || count == 0));
+		if (!vector_seg_reserve(seg, seg->count + count))
+			return false;
+
+		const int08_t* source = (const int08_t*) data;
+		size_t mask = ((size_t) 1 << seg->shift) - 1;
+		while (count > 0) {
+			size_t offset = seg->count & mask;
+			size_t items = VECTOR_MIN(count, mask + 1 - offset);
+			int08_t* chunk = vector_at(&seg->chunks, int08_t*, seg->count >> seg->shift);
+			memcpy(chunk + offset * seg->typeSize, source, items * seg->typeSize);
+			source += items * seg->typeSize;
+			seg->count += items;
+			count -= items;
+		}
+		return true;
+	}
+
+	/// Returns TRUE if [data] was appended, else FALSE.
+	bool_t vector_seg_push(vector_seg* seg, const void_t* data) {
+		VECTOR_ASSERT(seg != NULL && data != NULL);
+		if (seg->count == vector_seg_capacity(seg) && !vector_seg_reserve(seg, seg->count + 1))
+			return false;
+
+		seg->count++;
+		memcpy(vector_seg_get(seg, seg->count - 1), data, seg->typeSize);
+		return true;
+	}
+
+	/// Returns TRUE if the last element was removed (copied to [data] if not NULL), else FALSE. Chunks are kept for reuse.
+	bool_t vector_seg_pop(vector_seg* seg, void_t* data) {
+		VECTOR_ASSERT(seg != NULL);
+		if (seg->count == 0)
+			return false;
+
+		if (data != NULL)
+			memcpy(data, vector_seg_get(seg, seg->count - 1), seg->typeSize);
+		seg->count--;
+		return true;
+	}
+
+	/// Returns a new contiguous vector (from [allocator], NULL uses calloc) holding a copy of every element, one memcpy per chunk.
+	///		Returns an unallocated vector if the segmented vector is empty or the allocation failed.
+	vector vector_seg_flatten(vector_seg* seg, vector_allocator* allocator) {
+		vector result = vector_calloc3(seg->typeSize, seg->count, seg->count > 0, allocator);
+		if (result.data == NULL)
+			return result;
+
+		size_t items;
+		for (size_t k = 0; vector_seg_chunk(seg, k, &items) != NULL; k++)
+			vector_append_range(&result, vector_at(&seg->chunks, int08_t*, k), items);
+		return result;
+	}
+
+	#ifdef VECTOR_MMAP
+		/// 
+		/// File-Backed Vectors
+		///		vector_mmap_open() maps a file of fixed-size records as the vector's
+		///		data: the item count is the file size / typeSize, growth becomes
+		///		ftruncate + remap and vector_free() unmaps, truncates the file to
+		///		the item count and closes it. All other vector functions work as
+		///		usual, e.g. vector_insert() appends records to the file.
+		///		
+		///		VECTOR_MMAP_READ maps the file copy-on-write for zero-copy lookups
+		///		straight from the page cache: changes are never written back and
+		///		the vector cannot grow. VECTOR_MMAP_WRITE maps it shared (created
+		///		if missing, emptied first with VECTOR_MMAP_TRUNCATE).
+		///		
+		///		Requires POSIX declarations: compile with -std=gnu11 or define
+		///		_POSIX_C_SOURCE 200809L (_GNU_SOURCE on Linux for mremap) first.
+		/// 
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#include <fcntl.h>
+		#include <unistd.h>
+
+		#define VECTOR_MMAP_READ     0x0u // Read-only: private mapping, never written back, cannot grow.
+		#define VECTOR_MMAP_WRITE    0x1u // Read/write: shared mapping, file created if missing.
+		#define VECTOR_MMAP_TRUNCATE 0x2u // Empty the file on open (with VECTOR_MMAP_WRITE).
+
+		/// File mapping allocator owned by a file-backed vector.
+		typedef struct vector_mmap_file {
+			vector_allocator allocator; // Mapping Allocator (vector->allocator points here)
+			int descriptor;  // File Descriptor
+			uint32_t flags;  // Open Flags (VECTOR_MMAP_*)
+		} vector_mmap_file;
+
+		void_t* vector_mmap_map(vector_mmap_file* file, size_t size) {
+			int shared = (file->flags & VECTOR_MMAP_WRITE)? MAP_SHARED : MAP_PRIVATE;
+			void_t* data = mmap(NULL, size, PROT_READ | PROT_WRITE, shared, file->descriptor, 0);
+			return (data != MAP_FAILED)? data : NULL;
+		}
+
+		void_t* vector_mmap_allocate(void_t* context, size_t size) {
+			vector_mmap_file* file = (vector_mmap_file*) context;
+			if (!(file->flags & VECTOR_MMAP_WRITE) || ftruncate(file->descriptor, (off_t)size) != 0)
+				return NULL;
+
+			return vector_mmap_map(file, size);
+		}
+
+		void_t* vector_mmap_reallocate(void_t* context, void_t* data, size_t oldSize, size_t newSize) {
+			vector_mmap_file* file = (vector_mmap_file*) context;
+			if (!(file->flags & VECTOR_MMAP_WRITE) || ftruncate(file->descriptor, (off_t)newSize) != 0)
+				return NULL;
+
+			#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+				void_t* moved = mremap(data, oldSize, newSize, MREMAP_MAYMOVE);
+				return (moved != MAP_FAILED)? moved : NULL;
+			#else
+				void_t* moved = vector_mmap_map(file, newSize);
+				if (moved != NULL) munmap(data, oldSize);
+				return moved;
+			#endif
+		}
+
+		void_t vector_mmap_release(void_t* context, void_t* data, size_t size) {
+			(void_t) context;
+			munmap(data, size);
+		}
+
+		/// Returns a vector mapping the records of the file at [path] (VECTOR_MMAP_* flags), flagged VECTOR_FLAG_MAPPED on success.
+		///		On failure the returned vector has no VECTOR_FLAG_MAPPED flag and no data. VECTOR_MMAP_WRITE fails for files whose
+		///		size is not a multiple of [typeSize], since closing would truncate the trailing partial record; read-only
+		///		mappings ignore it.
+		vector vector_mmap_open(const char_t* path, int32_t typeSize, uint32_t flags) {
+			vector result = { .typeSize = typeSize };
+			bool_t writable = (flags & VECTOR_MMAP_WRITE) != 0;
+			int descriptor = open(path, writable? (O_RDWR | O_CREAT | ((flags & VECTOR_MMAP_TRUNCATE)? O_TRUNC : 0)) : O_RDONLY, 0644);
+			if (descriptor < 0)
+				return result;
+
+			struct stat info;
+			vector_mmap_file* file = (vector_mmap_file*) malloc(sizeof(vector_mmap_file));
+			if (file == NULL || fstat(descriptor, &info) != 0 || (writable && (size_t)info.st_size % (size_t)typeSize != 0)) {
+				free(file);
+				close(descriptor);
+				return result;
+			}
+
+			file->allocator = (vector_allocator) { vector_mmap_allocate, vector_mmap_reallocate, vector_mmap_release, file, false };
+			file->descriptor = descriptor;
+			file->flags = flags;
+
+			size_t bytes = ((size_t)info.st_size / (size_t)typeSize) * (size_t)typeSize;
+			void_t* data = (bytes > 0)? vector_mmap_map(file, bytes) : NULL;
+			if (bytes > 0 && data == NULL) {
+				free(file);
+				close(descriptor);
+				return result;
+			}
+
+			return (vector) { .typeSize = typeSize, .length = bytes, .iterator = bytes, .data = data, .allocator = &file->allocator, .flags = VECTOR_FLAG_MAPPED };
+		}
+
+		/// Returns TRUE if the vector is file-backed (opened by vector_mmap_open), else FALSE.
+		bool_t vector_ismapped(vector* vector) {
+			return (vector->flags & VECTOR_FLAG_MAPPED) != 0;
+		}
+
+		/// Returns TRUE if the file-backed vector was flushed to its file (blocking unless [async] is TRUE), else FALSE.
+		bool_t vector_mmap_sync(vector* vector, bool_t async) {
+			if (!(vector->flags & VECTOR_FLAG_MAPPED))
+				return false;
+
+			vector_mmap_file* file = (vector_mmap_file*) vector->allocator->context;
+			if (vector->data == NULL || !(file->flags & VECTOR_MMAP_WRITE))
+				return true;
+
+			return msync(vector->data, vector->length, async? MS_ASYNC : MS_SYNC) == 0;
+		}
+
+		/// Returns TRUE if the file-backed vector was unmapped, its file truncated to the item count and closed, else FALSE.
+		///		Called by vector_free() for file-backed vectors.
+		bool_t vector_mmap_close(vector* vector) {
+			if (!(vector->flags & VECTOR_FLAG_MAPPED))
+				return false;
+
+			vector_mmap_file* file = (vector_mmap_file*) vector->allocator->context;
+			if (vector->data != NULL)
+				munmap(vector->data, vector->length);
+
+			bool_t result = !(file->flags & VECTOR_MMAP_WRITE) || ftruncate(file->descriptor, (off_t)vector->iterator) == 0;
+			result = (close(file->descriptor) == 0) && result;
+			free(file);
+
+			vector->data = NULL;
+			vector->allocator = NULL;
+			vector->flags &= ~VECTOR_FLAG_MAPPED;
+			vector->length = vector->iterator = 0;
+			return result;
+		}
+
+		/// 
+		/// Page Allocators
+		///		vector_pages is an allocator backend that maps anonymous memory
+		///		directly with mmap, for vectors of many GB where page size and
+		///		placement matter. The pages are not touched when mapped, so
+		///		physical memory is placed by whichever thread first writes them
+		///		(see vector_first_touch) unless a NUMA policy is set:
+		///		
+		///		VECTOR_PAGES_HUGE:	transparent huge pages (madvise), 2 MB aligned data.
+		///		VECTOR_PAGES_HUGETLB:	explicit huge pages (MAP_HUGETLB), normal pages if none are reserved.
+		///		VECTOR_PAGES_BIND:	pages only come from NUMA node [node] (mbind MPOL_BIND).
+		///		VECTOR_PAGES_INTERLEAVE:	pages round-robin across the allowed NUMA nodes (mbind MPOL_INTERLEAVE).
+		///		
+		///		Huge pages and NUMA policies are Linux only (the flags are ignored
+		///		elsewhere and on kernels built without NUMA support). Growth tries
+		///		to extend the mapping in place, else maps a new one and copies, so
+		///		reserve the final capacity up front for very large vectors.
+		///		
+		///		Requires anonymous mappings (MAP_ANONYMOUS): compile with -std=gnu11
+		///		or define _DEFAULT_SOURCE first, else the section is left out.
+		/// 
+		#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+			#define MAP_ANONYMOUS MAP_ANON
+		#endif
+	#endif
+
+	#if defined(VECTOR_MMAP) && defined(MAP_ANONYMOUS)
+		#ifdef __linux__
+			#include <sys/syscall.h>
+			#include <errno.h>
+		#endif
+
+		#define VECTOR_PAGES_HUGE       0x1u // Transparent huge pages (madvise MADV_HUGEPAGE).
+		#define VECTOR_PAGES_HUGETLB    0x2u // Explicit huge pages (MAP_HUGETLB), falls back to normal pages.
+		#define VECTOR_PAGES_BIND       0x4u // Bind pages to one NUMA node.
+		#define VECTOR_PAGES_INTERLEAVE 0x8u // Interleave pages across the allowed NUMA nodes.
+
+		/// Huge page size: mapping sizes and VECTOR_PAGES_HUGE data are aligned to it.
+		#ifndef VECTOR_HUGE_PAGE
+			#define VECTOR_HUGE_PAGE (2u * 1024u * 1024u)
+		#endif
+
+		/// Highest NUMA node count supported by VECTOR_PAGES_BIND / VECTOR_PAGES_INTERLEAVE (multiple of 64).
+		#ifndef VECTOR_NUMA_NODES
+			#define VECTOR_NUMA_NODES 64
+		#endif
+
+		/// Anonymous page allocator: huge pages and NUMA placement for large vectors.
+		typedef struct vector_pages {
+			vector_allocator allocator; // Pass &pages.allocator to vector_calloc3()
+			uint32_t flags; // Page Flags (VECTOR_PAGES_*)
+			int32_t node;   // NUMA Node (VECTOR_PAGES_BIND)
+		} vector_pages;
+
+		/// Returns [size] rounded up to the mapping granularity of [pages].
+		size_t vector_pages_size(vector_pages* pages, size_t size) {
+			size_t page = (pages->flags & (VECTOR_PAGES_HUGE | VECTOR_PAGES_HUGETLB))? VECTOR_HUGE_PAGE : (size_t) sysconf(_SC_PAGESIZE);
+			return (size + page - 1) & ~(page - 1);
+		}
+
+		/// Returns TRUE if the NUMA policy of [pages] was applied to [data] of [size] bytes (or there is none, or no NUMA support), else FALSE.
+		bool_t vector_pages_bind(vector_pages* pages, void_t* data, size_t size) {
+			#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+				if (!(pages->flags & (VECTOR_PAGES_BIND | VECTOR_PAGES_INTERLEAVE)))
+					return true;
+
+				const size_t bits = 8 * sizeof(unsigned long);
+				unsigned long mask[VECTOR_NUMA_NODES / (8 * sizeof(unsigned long))] = { 0 };
+				int mode;
+				if (pages->flags & VECTOR_PAGES_INTERLEAVE) {
+					mode = 3; // MPOL_INTERLEAVE
+					if (syscall(SYS_get_mempolicy, NULL, mask, (unsigned long) VECTOR_NUMA_NODES, NULL, 4ul /* MPOL_F_MEMS_ALLOWED */) != 0)
+						return errno == ENOSYS;
+				} else {
+					mode = 2; // MPOL_BIND
+					if (pages->node < 0 || pages->node >= VECTOR_NUMA_NODES)
+						return false;
+					mask[(size_t) pages->node / bits] = 1ul << ((size_t) pages->node % bits);
+				}
+
+				return syscall(SYS_mbind, data, (unsigned long) size, mode, mask, (unsigned long) VECTOR_NUMA_NODES + 1, 0u) == 0 || errno == ENOSYS;
+			#else
+				(void_t) pages; (void_t) data; (void_t) size;
+				return true;
+			#endif
+		}
+
+		/// Returns a new mapping of [size] bytes (a multiple of vector_pages_size) with the page flags and NUMA policy of [pages] applied, or NULL.
+		void_t* vector_pages_map(vector_pages* pages, size_t size) {
+			int08_t* data = (int08_t*) MAP_FAILED;
+			#ifdef MAP_HUGETLB
+				if (pages->flags & VECTOR_PAGES_HUGETLB)
+					data = (int08_t*) mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			#endif
+
+			if (data == (int08_t*) MAP_FAILED) {
+				// Over-map by one huge page and trim both ends so transparent huge pages can back the whole range.
+				size_t align = (pages->flags & (VECTOR_PAGES_HUGE | VECTOR_PAGES_HUGETLB))? VECTOR_HUGE_PAGE : 0;
+				int08_t* raw = (int08_t*) mmap(NULL, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (raw == (int08_t*) MAP_FAILED)
+					return NULL;
+
+				size_t lead = (align > 0)? (align - ((uintptr_t) raw & (align - 1))) & (align - 1) : 0;
+				if (lead > 0) munmap(raw, lead);
+				if (align > lead) munmap(raw + lead + size, align - lead);
+				data = raw + lead;
+			}
+
+			#ifdef MADV_HUGEPAGE
+				if (pages->flags & VECTOR_PAGES_HUGE)
+					madvise(data, size, MADV_HUGEPAGE);
+			#endif
+
+			if (!vector_pages_bind(pages, data, size)) {
+				munmap(data, size);
+				return NULL;
+			}
+			return data;
+		}
+
+		void_t* vector_pages_allocate(void_t* context, size_t size) {
+			vector_pages* pages = (vector_pages*) context;
+			return vector_pages_map(pages, vector_pages_size(pages, size));
+		}
+
+		void_t* vector_pages_reallocate(void_t* context, void_t* data, size_t oldSize, size_t newSize) {
+			vector_pages* pages = (vector_pages*) context;
+			size_t oldMapped = vector_pages_size(pages, oldSize), newMapped = vector_pages_size(pages, newSize);
+			if (newMapped <= oldMapped) {
+				if (newMapped < oldMapped)
+					munmap((int08_t*) data + newMapped, oldMapped - newMapped);
+				return data;
+			}
+
+			#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+				// Extend in place only: a moved mapping would lose the huge page alignment.
+				if (mremap(data, oldMapped, newMapped, 0) != MAP_FAILED) {
+					#ifdef MADV_HUGEPAGE
+						if (pages->flags & VECTOR_PAGES_HUGE)
+							madvise(data, newMapped, MADV_HUGEPAGE);
+					#endif
+					if (vector_pages_bind(pages, data, newMapped))
+						return data;
+					munmap((int08_t*) data + oldMapped, newMapped - oldMapped);
+					return NULL;
+				}
+			#endif
+
+			void_t* moved = vector_pages_map(pages, newMapped);
+			if (moved == NULL)
+				return NULL;
+
+			vector_copy_bytes(moved, data, VECTOR_MIN(oldSize, newSize));
+			munmap(data, oldMapped);
+			return moved;
+		}
+
+		void_t vector_pages_release(void_t* context, void_t* data, size_t size) {
+			munmap(data, vector_pages_size((vector_pages*) context, size));
+		}
+
+		/// Initializes [pages] as a page allocator with VECTOR_PAGES_* [flags] and the NUMA [node] used by VECTOR_PAGES_BIND.
+		void_t vector_pages_init(vector_pages* pages, uint32_t flags, int32_t node) {
+			pages->flags = flags;
+			pages->node = node;
+			pages->allocator = (vector_allocator) { vector_pages_allocate, vector_pages_reallocate, vector_pages_release, pages, true };
+		}
+	#endif
+
+	/// 
+	/// Small Vectors
+	///		VECTOR_SMALL_DEFINE(name, N) emits a struct holding a vector and an
+	///		N-byte inline buffer next to it. Elements live in the inline buffer
+	///		(no allocation) until it overflows, after which the vector spills to
+	///		the heap and behaves as usual. Use the returned vector* with the
+	///		regular vector_get/vector_insert/vector_remove API.
+	///		
+	///			VECTOR_SMALL_DEFINE(vec_small8, 8 * sizeof(int32_t))
+	///			vec_small8 storage;
+	///			vector* ints = vec_small8_init(&storage, sizeof(int32_t));
+	///			vector_insert(ints, &value, vector_count(ints));
+	///			vector_free(ints);
+	///		
+	///		NOTE: the vector points into its own struct: do not copy or move a
+	///		small vector struct while it is still stored inline.
+	/// 
+	#define VECTOR_SMALL_DEFINE(name, N)\
+		typedef struct name {\
+			vector vector; /* Vector (data points to buffer until it spills) */\
+			union { int08_t bytes[N]; uint64_t u64; float64_t f64; void_t* ptr; } buffer; /* Inline Storage */\
+		} name;\
+		\
+		/* Returns the vector of [small] initialized over its inline buffer. */\
+		static inline vector* name##_init(name* small, int32_t typeSize) {\
+			small->vector = vector_calloc_inline(typeSize, small->buffer.bytes, N, NULL);\
+			return &small->vector;\
+		}
+
+	/// 
+	/// Typed Vector Generator
+	///		VECTOR_DEFINE(name, T) emits a vector specialized for element type T,
+	///		so element size and stride are compile-time constants and accessors
+	///		return T* instead of void_t*. Counts and capacities are in items.
+	///		
+	///			VECTOR_DEFINE(vec_particle, particle)
+	///			vec_particle particles = vec_particle_calloc(1024);
+	///			vec_particle_push(&particles, &p);
+	///			particle* first = vec_particle_at(&particles, 0);
+	///		
+	///		The generic vector API remains the fallback for types whose size
+	///		is only known at runtime.
+	/// 
+	#define VECTOR_DEFINE(name, T)\
+		typedef struct name {\
+			T* data;          /* Data Pointer */\
+			size_t count;     /* Current Count (Items) */\
+			size_t capacity;  /* Current Size (Items) */\
+		} name;\
+		\
+		/* Returns a new typed vector with memory for [capacity] items (unallocated if capacity is 0 or calloc fails). */\
+		static inline name name##_calloc(size_t capacity) {\
+			T* data = (capacity > 0)? (T*) calloc(capacity, sizeof(T)) : NULL;\
+			return (name) { data, 0, (data != NULL)? capacity : 0 };\
+		}\
+		\
+		/* Returns TRUE if the typed vector was free'd, else FALSE if it is not allocated. */\
+		static inline bool_t name##_free(name* vector) {\
+			if (vector == NULL || vector->data == NULL) return false;\
+			free(vector->data);\
+			vector->data = NULL;\
+			vector->count = vector->capacity = 0;\
+			return true;\
+		}\
+		\
+		/* Returns TRUE if the typed vector can hold at least [capacity] items, else FALSE. Never shrinks. */\
+		static inline bool_t name##_reserve(name* vector, size_t capacity) {\
+			if (capacity <= vector->capacity) return true;\
+			T* data = (T*) realloc(vector->data, capacity * sizeof(T));\
+			if (data == NULL) return false;\
+			vector->data = data;\
+			vector->capacity = capacity;\
+			return true;\
+		}\
+		\
+		/* Returns TRUE if there is room for one more item (growing to [capacity * 2] if needed), else FALSE. */\
+		static inline bool_t name##_grow(name* vector) {\
+			if (vector->count < vector->capacity) return true;\
+			return name##_reserve(vector, (vector->capacity > 0)? vector->capacity << 1 : VECTOR_DEFAULT_LENGTH);\
+		}\
+		\
+		/* Returns the item count of a typed vector. */\
+		static inline size_t name##_count(const name* vector) {\
+			return vector->count;\
+		}\
+		\
+		/* Returns a pointer to the item at [index] without bounds checks (asserted with VECTOR_DEBUG). */\
+		static inline T* name##_at(const name* vector, size_t index) {\
+			VECTOR_ASSERT(vector->data != NULL && index < vector->count);\
+			return vector->data + index;\
+		}\
+		\
+		/* Returns NULL if index is not within bounds count > index >= 0 or returns pointer to the item. */\
+		static inline T* name##_get(const name* vector, size_t index) {\
+			return (vector->data == NULL || index >= vector->count)? NULL : vector->data + index;\
+		}\
+		\
+		/* Returns TRUE if the item was appended to the end of the typed vector, else FALSE. */\
+		static inline bool_t name##_push(name* vector, const T* data) {\
+			if (!name##_grow(vector)) return false;\
+			vector->data[vector->count++] = *data;\
+			return true;\
+		}\
+		\
+		/* Returns TRUE if the item at [index] can be written (count >= index >= 0), else FALSE. */\
+		static inline bool_t name##_insert(name* vector, const T* data, size_t index) {\
+			if (index > vector->count || !name##_grow(vector)) return false;\
+			memmove(vector->data + index + 1, vector->data + index, (vector->count - index) * sizeof(T));\
+			vector->data[index] = *data;\
+			vector->count++;\
+			return true;\
+		}\
+		\
+		/* Returns TRUE if the item replaces an existing item in the typed vector, else FALSE. */\
+		static inline bool_t name##_replace(name* vector, const T* data, size_t index) {\
+			if (vector->data == NULL || index >= vector->count) return false;\
+			vector->data[index] = *data;\
+			return true;\
+		}\
+		\
+		/* Returns TRUE if the item at [index] can be removed, else FALSE. */\
+		static inline bool_t name##_remove(name* vector, size_t index) {\
+			if (vector->data == NULL || index >= vector->count) return false;\
+			vector->count--;\
+			memmove(vector->data + index, vector->data + index + 1, (vector->count - index) * sizeof(T));\
+			return true;\
+		}\
+		\
+		/* Returns the last item removed from the end of the typed vector into [out] (may be NULL), or FALSE if empty. */\
+		static inline bool_t name##_pop(name* vector, T* out) {\
+			if (vector->count == 0) return false;\
+			vector->count--;\
+			if (out != NULL) *out = vector->data[vector->count];\
+			return true;\
+		}
+
+	/// 
+	/// Typed Sort Generator
+	///		VECTOR_DEFINE_SORT(name, T, LESS) emits an introsort specialized for T
+	///		and an inlinable comparator: LESS(a, b) is a macro or inline function
+	///		taking two T values and returning non-zero if a orders before b.
+	///		Quicksort (median of three, Hoare partition) falls back to heapsort
+	///		past 2*log2(count) levels and to insertion sort below 16 items.
+	///		
+	///			#define int32_less(a, b) ((a) < (b))
+	///			VECTOR_DEFINE_SORT(sort_int32, int32_t, int32_less)
+	///			sort_int32(array, count);
+	///			sort_int32_vector(&vints);
+	/// 
+	#define VECTOR_DEFINE_SORT(name, T, LESS)\
+		static inline void_t name##_swap(T* a, T* b) {\
+			T item = *a; *a = *b; *b = item;\
+		}\
+		\
+		static inline void_t name##_insertion(T* data, size_t count) {\
+			for (size_t i = 1; i < count; i++) {\
+				T item = data[i];\
+				size_t j = i;\
+				for (; j > 0 && LESS(item, data[j - 1]); j--)\
+					data[j] = data[j - 1];\
+				data[j] = item;\
+			}\
+		}\
+		\
+		static inline void_t name##_sift(T* data, size_t root, size_t count) {\
+			T item = data[root];\
+			for (size_t child; (child = 2 * root + 1) < count; root = child) {\
+				if (child + 1 < count && LESS(data[child], data[child + 1])) child++;\
+				if (!LESS(item, data[child])) break;\
+				data[root] = data[child];\
+			}\
+			data[root] = item;\
+		}\
+		\
+		static inline void_t name##_heap(T* data, size_t count) {\
+			for (size_t i = count >> 1; i > 0; i--)\
+				name##_sift(data, i - 1, count);\
+			for (size_t end = count - 1; end > 0; end--) {\
+				name##_swap(&data[0], &data[end]);\
+				name##_sift(data, 0, end);\
+			}\
+		}\
+		\
+		static inline void_t name##_intro(T* data, size_t count, size_t depth) {\
+			while (count > 16) {\
+				if (depth-- == 0) {\
+					name##_heap(data, count);\
+					return;\
+				}\
+				\
+				size_t middle = count >> 1;\
+				if (LESS(data[middle], data[0])) name##_swap(&data[middle], &data[0]);\
+				if (LESS(data[count - 1], data[middle])) {\
+					name##_swap(&data[count - 1], &data[middle]);\
+					if (LESS(data[middle], data[0])) name##_swap(&data[middle], &data[0]);\
+				}\
+				\
+				T pivot = data[middle];\
+				size_t i = (size_t)-1, j = count;\
+				for (;;) {\
+					do i++; while (LESS(data[i], pivot));\
+					do j--; while (LESS(pivot, data[j]));\
+					if (i >= j) break;\
+					name##_swap(&data[i], &data[j]);\
+				}\
+				\
+				size_t split = j + 1;\
+				if (split < count - split) {\
+					name##_intro(data, split, depth);\
+					data += split;\
+					count -= split;\
+				} else {\
+					name##_intro(data + split, count - split, depth);\
+					count = split;\
+				}\
+			}\
+			name##_insertion(data, count);\
+		}\
+		\
+		/* Sorts [count] items of [data] in ascending LESS order (not stable). */\
+		static inline void_t name(T* data, size_t count) {\
+			size_t depth = 0;\
+			for (size_t n = count; n > 1; n >>= 1) depth += 2;\
+			name##_intro(data, count, depth);\
+		}\
+		\
+		/* Returns TRUE if the items of a generic vector holding T were sorted in ascending LESS order (not stable), else FALSE (unsharing failed). */\
+		static inline bool_t name##_vector(vector* vector) {\
+			VECTOR_ASSERT(vector != NULL && (size_t)vector->typeSize == sizeof(T));\
+			if (vector_count(vector) < 2)\
+				return true;\
+			if (!VECTOR_WRITABLE(vector))\
+				return false;\
+			name((T*) vector->data, vector_count(vector));\
+			return true;\
+		}
+
+	/// 
+	/// Typed Search Generator
+	///		VECTOR_DEFINE_SEARCH(name, T, LESS) emits branchless binary searches
+	///		over sorted arrays of T with an inlinable LESS(a, b) comparator (see
+	///		VECTOR_DEFINE_SORT), plus an Eytzinger (BFS) layout for large tables:
+	///		the layout holds count + 1 items with [0] unused, and searches touch
+	///		memory top-down so the hot upper levels share a few cache lines.
+	///		
+	///			VECTOR_DEFINE_SEARCH(search_int32, int32_t, int32_less)
+	///			size_t at = search_int32_lower_bound(array, count, key);
+	///			search_int32_eytzinger(array, layout, count);
+	///			size_t node = search_int32_eytzinger_lower_bound(layout, count, key);
+	/// 
+	#define VECTOR_DEFINE_SEARCH(name, T, LESS)\
+		/* Returns the index of the first item not ordering before [key] (count if none). */\
+		static inline size_t name##_lower_bound(const T* data, size_t count, T key) {\
+			const T* base = data;\
+			if (count == 0) return 0;\
+			for (size_t n = count; n > 1; n -= n >> 1)\
+				base = (LESS(base[n >> 1], key))? base + (n >> 1) : base;\
+			return (size_t)(base - data) + (LESS(*base, key)? 1 : 0);\
+		}\
+		\
+		/* Returns the index of the first item ordering after [key] (count if none). */\
+		static inline size_t name##_upper_bound(const T* data, size_t count, T key) {\
+			const T* base = data;\
+			if (count == 0) return 0;\
+			for (size_t n = count; n > 1; n -= n >> 1)\
+				base = (!LESS(key, base[n >> 1]))? base + (n >> 1) : base;\
+			return (size_t)(base - data) + (!LESS(key, *base)? 1 : 0);\
+		}\
+		\
+		/* Returns a pointer to the first item equal to [key], or NULL if not found. */\
+		static inline T* name##_bsearch(T* data, size_t count, T key) {\
+			size_t index = name##_lower_bound(data, count, key);\
+			return (index < count && !LESS(key, data[index]))? data + index : NULL;\
+		}\
+		\
+		/* Returns TRUE if [item] was inserted after any equal items of a sorted generic vector holding T, else FALSE. */\
+		static inline bool_t name##_insert_sorted(vector* vector, T* item) {\
+			VECTOR_ASSERT(vector != NULL && (size_t)vector->typeSize == sizeof(T));\
+			return vector_insert(vector, item, name##_upper_bound((const T*) vector->data, vector_count(vector), *item));\
+		}\
+		\
+		static inline size_t name##_eytzinger_fill(const T* sorted, T* layout, size_t count, size_t index, size_t node) {\
+			if (node <= count) {\
+				index = name##_eytzinger_fill(sorted, layout, count, index, 2 * node);\
+				layout[node] = sorted[index++];\
+				index = name##_eytzinger_fill(sorted, layout, count, index, 2 * node + 1);\
+			}\
+			return index;\
+		}\
+		\
+		/* Writes the [count] sorted items into [layout] (count + 1 items, [0] unused) in Eytzinger order. */\
+		static inline void_t name##_eytzinger(const T* sorted, T* layout, size_t count) {\
+			name##_eytzinger_fill(sorted, layout, count, 0, 1);\
+		}\
+		\
+		/* Returns the layout node of the first item not ordering before [key], or 0 if none. */\
+		static inline size_t name##_eytzinger_lower_bound(const T* layout, size_t count, T key) {\
+			size_t node = 1;\
+			while (node <= count)\
+				node = 2 * node + (LESS(layout[node], key)? 1 : 0);\
+			return node >> (vector_ctz(~(uint64_t)node) + 1);\
+		}
+
 #endif